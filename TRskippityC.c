@@ -5,6 +5,23 @@
 #include <string.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#if (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#include <immintrin.h>
+#define SKIPPITY_X86_SIMD 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa)
+#endif
 
 #ifdef _WIN32
 #include <windows.h>
@@ -13,6 +30,10 @@
 #undef min
 #else
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #undef max
 #undef min
 #endif
@@ -28,6 +49,17 @@ void sleep_ms(int milliseconds)
 #endif
 }
 
+long long currentTimeMs()
+{
+#ifdef _WIN32
+    return (long long)GetTickCount64();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#endif
+}
+
 void print_with_delay(const char *str, int delay_ms)
 {
     while (*str)
@@ -60,6 +92,63 @@ void clearScreen()
 #define max(a, b) ((a) > (b) ? (a) : (b))
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+#define MIN_SIZE 6
+#define MAX_SIZE 20
+#define BOARD_BORDER 2
+#define BOARD_STRIDE (MAX_SIZE + 2 * BOARD_BORDER)
+#define BOARD_CELLS (BOARD_STRIDE * BOARD_STRIDE)
+#define BORDER_CELL '#'
+#define MAX_CELLS (MAX_SIZE * MAX_SIZE)
+#define BITSET_WORDS ((MAX_CELLS + 63) / 64)
+#define MAX_MOVES (4 * MAX_CELLS)
+#define MAX_CHAIN 32
+#define CHAIN_SEEN_SLOTS 256
+
+#define TT_BUCKET_ENTRIES 4
+#define TT_EXACT 0
+#define TT_LOWER 1
+#define TT_UPPER 2
+#define TT_NO_MOVE 0xFFFFF
+#define TT_FILE_MAGIC 0x4C42545950494B53ULL
+#define TT_FILE_VERSION 1
+#define TT_FILE_HEADER_BYTES 4096
+
+#define SIMD_AUTO -1
+#define SIMD_SCALAR 0
+#define SIMD_SSE42 1
+#define SIMD_AVX2 2
+#define SIMD_AVX512 3
+
+#define MAX_THREADS 64
+#define MAX_PLY 64
+#define HISTORY_MAX 0xFFFFF
+#define ASPIRATION_WINDOW 1000
+#define MOVE_TIME_MS 2000
+#define DEADLINE_POLL_MASK 15
+#define SCORE_INFINITY INT_MAX
+#define LATE_MOVE_INDEX 6
+#define LATE_MOVE_MIN_DEPTH 3
+#define FUTILITY_MARGIN 300
+#define FUTILITY_MAX_DEPTH 2
+#define MAX_MULTI_PV 8
+#define MAX_PV_LENGTH 16
+#define HINT_LINES 3
+#define HINT_DEPTH 2
+#define HINT_TT_MB 1
+#define ENGINE_PREDICTIONS 2
+
+#define SEARCH_PROFILE_MEDIUM 0
+#define SEARCH_PROFILE_EXTREME 1
+#define SEARCH_PROFILES 2
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FORCE_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define FORCE_INLINE static __forceinline
+#else
+#define FORCE_INLINE static inline
+#endif
+
 typedef struct
 {
     int score;
@@ -68,15 +157,35 @@ typedef struct
     int extraPieces;
     int undoUsed;
     int redoUsed;
+    int typesAtMin;
 } Player;
 
+typedef struct
+{
+    Player players[2];
+    int sideToMove;
+} GameState;
+
+typedef struct
+{
+    int size;
+    char cells[BOARD_CELLS];
+} Board;
+
+typedef struct
+{
+    char capturedPiece;
+    int destSlot;
+    int legalJumpsDelta;
+} JumpUndo;
+
 typedef struct
 {
     int srcRow;
     int srcCol;
     int destRow;
     int destCol;
-    char capturedPiece;
+    JumpUndo undo;
 } Move;
 
 typedef struct
@@ -86,6 +195,219 @@ typedef struct
     int capacity;
 } MoveStack;
 
+typedef struct
+{
+    uint64_t words[BITSET_WORDS];
+} Bitset;
+
+typedef struct
+{
+    short mid;
+    short dest;
+} JumpEdge;
+
+typedef struct
+{
+    int size;
+    const JumpEdge (*edges)[4];
+    Bitset occupied;
+    Bitset pieces[5];
+    int pieceCounts[5];
+    int emptyCells[MAX_CELLS];
+    int emptySlot[MAX_CELLS];
+    int emptyCount;
+    int legalJumps;
+    uint64_t key;
+} SearchBoard;
+
+typedef struct
+{
+    short src;
+    short dest;
+    int length;
+    uint64_t path;
+} JumpMove;
+
+typedef struct
+{
+    JumpMove moves[MAX_MOVES];
+    int count;
+} MoveList;
+
+typedef struct
+{
+    int score;
+    int length;
+    JumpMove moves[MAX_PV_LENGTH];
+} AnalysisLine;
+
+typedef struct
+{
+    _Atomic uint64_t key;
+    _Atomic uint64_t data;
+} TTEntry;
+
+typedef struct
+{
+    TTEntry entries[TT_BUCKET_ENTRIES];
+} TTBucket;
+
+typedef struct
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t maxSize;
+    uint64_t bucketCount;
+    uint64_t checksum;
+    _Atomic uint32_t generation;
+} TTFileHeader;
+
+typedef struct
+{
+    TTBucket *buckets;
+    uint64_t bucketMask;
+    size_t bytes;
+    int generation;
+    int mapped;
+    TTFileHeader *file;
+} TranspositionTable;
+
+typedef struct
+{
+    int ttSizeMb;
+    int hugePages;
+    int moveTimeMs;
+    int threads;
+    int lazySmp;
+    int moveHeuristics;
+    int sizeKernels;
+    int simdLevel;
+    int aspirationWindow;
+    int lateMoveReductions;
+    int lateMoveIndex;
+    int futilityPruning;
+    int futilityMargin;
+    int scoreBounds;
+    int multiPv;
+    const char *ttFile;
+} EngineConfig;
+
+typedef struct
+{
+    int killers[MAX_PLY][2];
+    int history[MAX_CELLS][4];
+} SearchHeuristics;
+
+typedef struct
+{
+    uint64_t key;
+    int move;
+} PredictedPosition;
+
+typedef struct
+{
+    TranspositionTable table;
+    SearchHeuristics heuristics[MAX_THREADS];
+    PredictedPosition predictions[ENGINE_PREDICTIONS];
+    int nextPrediction;
+    long long predictedHits;
+} EngineContext;
+
+typedef struct
+{
+    long long nodes;
+    long long cutoffs;
+    long long firstMoveCutoffs;
+    long long killerCutoffs;
+    long long boundCutoffs;
+} SearchStats;
+
+typedef struct
+{
+    long long deadline;
+    int stopped;
+    atomic_int *abort;
+    TranspositionTable *table;
+    SearchHeuristics *heuristics;
+    int ply;
+    SearchStats stats;
+} SearchContext;
+
+typedef int (*SearchFunction)(SearchBoard *, int, int, int, GameState *, SearchContext *);
+typedef int (*EvaluateFunction)(const SearchBoard *, const GameState *);
+
+typedef struct
+{
+    int held;
+    int sets;
+    int vulnerable;
+    int extraPieces;
+} EvalWeights;
+
+typedef struct
+{
+    EngineContext *engine;
+    SearchBoard *searchBoard;
+    const GameState *state;
+    MoveList *moveList;
+    int depth;
+    SearchFunction search;
+    int alpha;
+    int beta;
+    int multiPv;
+    long long deadline;
+    atomic_int *abort;
+    atomic_int nextMove;
+    atomic_int nextSlot;
+    atomic_int threshold;
+    int rankedMoves[MAX_MULTI_PV];
+    int rankedScores[MAX_MULTI_PV];
+    int rankedCount;
+    int evaluations;
+    int stopped;
+    int firstMoveDone;
+    SearchStats stats;
+    pthread_mutex_t lock;
+    pthread_cond_t firstMoveSearched;
+} RootSearch;
+
+typedef struct
+{
+    EngineContext *engine;
+    SearchBoard *searchBoard;
+    const GameState *state;
+    MoveList *moveList;
+    int index;
+    int depth;
+    SearchFunction search;
+    long long deadline;
+    atomic_int *abort;
+    SearchStats stats;
+} LazyHelper;
+
+EngineConfig engineConfig = {16, 0, -1, 1, 0, 1, 1, SIMD_AUTO, ASPIRATION_WINDOW, 0, LATE_MOVE_INDEX, 1, FUTILITY_MARGIN, 0, 1, NULL};
+EngineContext engineContext;
+EngineContext secondEngineContext;
+EngineContext hintContext;
+SearchStats lastSearchStats;
+AnalysisLine lastAnalysis[MAX_MULTI_PV];
+int lastAnalysisCount = 0;
+
+const EvalWeights evalProfiles[SEARCH_PROFILES] = {
+    {100, 0, 1, 1},
+    {300, 400, 10, 10},
+};
+
+uint64_t zobristCells[MAX_CELLS][5];
+uint64_t zobristPieces[2][5][MAX_CELLS + 1];
+uint64_t zobristSize[MAX_SIZE + 1];
+uint64_t zobristPreset[SEARCH_PROFILES];
+uint64_t zobristSide;
+int zobristReady = 0;
+
+JumpEdge jumpEdges[MAX_SIZE + 1][MAX_CELLS][4];
+int jumpTablesReady = 0;
+
 void initMoveStack(MoveStack *stack, int capacity)
 {
     stack->moves = (Move *)malloc(sizeof(Move) * capacity);
@@ -122,7 +444,7 @@ Move popMove(MoveStack *stack)
     {
         return stack->moves[stack->top--];
     }
-    Move emptyMove = {-1, -1, -1, -1, ' '};
+    Move emptyMove = {-1, -1, -1, -1, {' ', 0, 0}};
     return emptyMove;
 }
 
@@ -132,7 +454,7 @@ Move peekMove(MoveStack *stack)
     {
         return stack->moves[stack->top];
     }
-    Move emptyMove = {-1, -1, -1, -1, ' '};
+    Move emptyMove = {-1, -1, -1, -1, {' ', 0, 0}};
     return emptyMove;
 }
 
@@ -161,23 +483,40 @@ void printColoredChar(char c)
     }
 }
 
-char **createBoard(int size)
+int boardIndex(int row, int col)
+{
+    return (row + BOARD_BORDER) * BOARD_STRIDE + col + BOARD_BORDER;
+}
+
+char getCell(const Board *board, int row, int col)
+{
+    return board->cells[boardIndex(row, col)];
+}
+
+void setCell(Board *board, int row, int col, char piece)
+{
+    board->cells[boardIndex(row, col)] = piece;
+}
+
+int canJumpToward(const Board *board, int row, int col, int offset)
 {
+    int cell = boardIndex(row, col);
+    return board->cells[cell + 2 * offset] == ' ' && board->cells[cell + offset] != ' ';
+}
 
-    char **board = (char **)malloc(size * sizeof(char *));
+Board *createBoard(int size)
+{
+    Board *board = (Board *)malloc(sizeof(Board));
+    board->size = size;
+    memset(board->cells, BORDER_CELL, sizeof(board->cells));
     for (int i = 0; i < size; i++)
     {
-        board[i] = (char *)malloc(size * sizeof(char));
-
-        for (int j = 0; j < size; j++)
-        {
-            board[i][j] = ' ';
-        }
+        memset(&board->cells[boardIndex(i, 0)], ' ', size);
     }
     return board;
 }
 
-void printBoard(char **board, int size, Player *player1, Player *player2, int gameMode, int controlMode, int selectedRow, int selectedCol, int highlight)
+void printBoard(Board *board, int size, Player *player1, Player *player2, int gameMode, int controlMode, int selectedRow, int selectedCol, int highlight)
 {
 
     printf("    ");
@@ -205,16 +544,16 @@ void printBoard(char **board, int size, Player *player1, Player *player2, int ga
             {
                 if (highlight && i == selectedRow && j == selectedCol)
                 {
-                    printf(BOLD WHITE "%c " RESET, board[i][j]);
+                    printf(BOLD WHITE "%c " RESET, getCell(board, i, j));
                 }
                 else
                 {
-                    printColoredChar(board[i][j]);
+                    printColoredChar(getCell(board, i, j));
                 }
             }
             else
             {
-                printColoredChar(board[i][j]);
+                printColoredChar(getCell(board, i, j));
             }
         }
         printf("|\n");
@@ -257,7 +596,7 @@ void printBoard(char **board, int size, Player *player1, Player *player2, int ga
            player1->extraPieces, player2->extraPieces);
 }
 
-void fillBoard(char **board, int size)
+void fillBoard(Board *board, int size)
 {
     char pieces[] = {'A', 'B', 'C', 'D', 'E'};
     int numPieces = sizeof(pieces) / sizeof(pieces[0]);
@@ -307,7 +646,7 @@ void fillBoard(char **board, int size)
 
             if (!((i == size / 2 || i == size / 2 - 1) && (j == size / 2 || j == size / 2 - 1)))
             {
-                board[i][j] = allPieces[index++];
+                setCell(board, i, j, allPieces[index++]);
             }
         }
     }
@@ -316,529 +655,1959 @@ void fillBoard(char **board, int size)
     free(pieceCounts);
 }
 
-void freeBoard(char **board, int size)
+void freeBoard(Board *board)
 {
-    for (int i = 0; i < size; i++)
+    free(board);
+}
+
+int popCount64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    while (word)
     {
-        free(board[i]);
+        word &= word - 1;
+        count++;
     }
-    free(board);
+    return count;
+#endif
 }
 
-void calculateScore(Player *player)
+int isPieceCell(char cell)
 {
-    int minPieces = player->pieces[0];
+    return cell >= 'A' && cell <= 'E';
+}
 
-    for (int i = 1; i < 5; i++)
+int countBoardJumpsScalar(const Board *board, int size)
+{
+    const int offsets[4] = {-BOARD_STRIDE, -1, 1, BOARD_STRIDE};
+    int count = 0;
+
+    for (int row = 0; row < size; row++)
     {
-        if (player->pieces[i] < minPieces)
+        for (int col = 0; col < size; col++)
         {
-            minPieces = player->pieces[i];
+            int cell = boardIndex(row, col);
+            if (!isPieceCell(board->cells[cell]))
+            {
+                continue;
+            }
+            for (int direction = 0; direction < 4; direction++)
+            {
+                char dest = board->cells[cell + 2 * offsets[direction]];
+                count += isPieceCell(board->cells[cell + offsets[direction]]) && !isPieceCell(dest) && dest != BORDER_CELL;
+            }
         }
     }
+    return count;
+}
 
-    player->sets = minPieces;
+#ifdef SKIPPITY_X86_SIMD
+SIMD_TARGET("sse4.2,popcnt") __m128i pieceMask128(__m128i cells)
+{
+    __m128i offset = _mm_sub_epi8(cells, _mm_set1_epi8('A'));
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(4)), offset);
+}
 
-    player->extraPieces = 0;
-    for (int i = 0; i < 5; i++)
+SIMD_TARGET("sse4.2,popcnt") int countBoardJumpsSse42(const Board *board, int size)
+{
+    const int offsets[4] = {-BOARD_STRIDE, -1, 1, BOARD_STRIDE};
+    const __m128i border = _mm_set1_epi8(BORDER_CELL);
+    int count = 0;
+
+    for (int cell = boardIndex(0, -BOARD_BORDER); cell < boardIndex(size, -BOARD_BORDER); cell += 16)
     {
-        player->extraPieces += player->pieces[i] - minPieces;
+        __m128i sources = pieceMask128(_mm_loadu_si128((const __m128i *)&board->cells[cell]));
+        for (int direction = 0; direction < 4; direction++)
+        {
+            __m128i mids = pieceMask128(_mm_loadu_si128((const __m128i *)&board->cells[cell + offsets[direction]]));
+            __m128i dests = _mm_loadu_si128((const __m128i *)&board->cells[cell + 2 * offsets[direction]]);
+            __m128i blocked = _mm_or_si128(pieceMask128(dests), _mm_cmpeq_epi8(dests, border));
+            count += _mm_popcnt_u32((unsigned)_mm_movemask_epi8(_mm_andnot_si128(blocked, _mm_and_si128(sources, mids))));
+        }
     }
+    return count;
+}
 
-    player->score = player->sets * 100 + player->extraPieces;
+SIMD_TARGET("avx2,popcnt") __m256i pieceMask256(__m256i cells)
+{
+    __m256i offset = _mm256_sub_epi8(cells, _mm256_set1_epi8('A'));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(4)), offset);
 }
 
-void undoMove(char **board, MoveStack *undoStack, MoveStack *redoStack, Player *currentPlayer, Player *opponentPlayer)
+SIMD_TARGET("avx2,popcnt") int countBoardJumpsAvx2(const Board *board, int size)
 {
-    if (!isMoveStackEmpty(undoStack))
+    const int offsets[4] = {-BOARD_STRIDE, -1, 1, BOARD_STRIDE};
+    const __m256i border = _mm256_set1_epi8(BORDER_CELL);
+    int count = 0;
+
+    for (int cell = boardIndex(0, -BOARD_BORDER); cell < boardIndex(size, -BOARD_BORDER); cell += 32)
     {
-        Move move = popMove(undoStack);
-        pushMove(redoStack, move);
+        __m256i sources = pieceMask256(_mm256_loadu_si256((const __m256i *)&board->cells[cell]));
+        for (int direction = 0; direction < 4; direction++)
+        {
+            __m256i mids = pieceMask256(_mm256_loadu_si256((const __m256i *)&board->cells[cell + offsets[direction]]));
+            __m256i dests = _mm256_loadu_si256((const __m256i *)&board->cells[cell + 2 * offsets[direction]]);
+            __m256i blocked = _mm256_or_si256(pieceMask256(dests), _mm256_cmpeq_epi8(dests, border));
+            count += _mm_popcnt_u32((unsigned)_mm256_movemask_epi8(_mm256_andnot_si256(blocked, _mm256_and_si256(sources, mids))));
+        }
+    }
+    return count;
+}
+
+SIMD_TARGET("avx512f,avx512bw,popcnt") __mmask64 pieceMask512(__m512i cells)
+{
+    __m512i offset = _mm512_sub_epi8(cells, _mm512_set1_epi8('A'));
+    return _mm512_cmple_epu8_mask(offset, _mm512_set1_epi8(4));
+}
 
-        board[move.srcRow][move.srcCol] = board[move.destRow][move.destCol];
-        board[move.destRow][move.destCol] = ' ';
+SIMD_TARGET("avx512f,avx512bw,popcnt") int countBoardJumpsAvx512(const Board *board, int size)
+{
+    const int offsets[4] = {-BOARD_STRIDE, -1, 1, BOARD_STRIDE};
+    const __m512i border = _mm512_set1_epi8(BORDER_CELL);
+    int end = boardIndex(size, -BOARD_BORDER);
+    int count = 0;
 
-        if (move.capturedPiece != ' ')
+    for (int cell = boardIndex(0, -BOARD_BORDER); cell < end; cell += 64)
+    {
+        __mmask64 lanes = end - cell >= 64 ? ~(__mmask64)0 : ((__mmask64)1 << (end - cell)) - 1;
+        __mmask64 sources = pieceMask512(_mm512_maskz_loadu_epi8(lanes, &board->cells[cell]));
+        for (int direction = 0; direction < 4; direction++)
         {
-            int midRow = (move.srcRow + move.destRow) / 2;
-            int midCol = (move.srcCol + move.destCol) / 2;
-            board[midRow][midCol] = move.capturedPiece;
-
-            currentPlayer->pieces[move.capturedPiece - 'A']--;
+            __mmask64 mids = pieceMask512(_mm512_maskz_loadu_epi8(lanes, &board->cells[cell + offsets[direction]]));
+            __m512i dests = _mm512_maskz_loadu_epi8(lanes, &board->cells[cell + 2 * offsets[direction]]);
+            __mmask64 blocked = pieceMask512(dests) | _mm512_cmpeq_epi8_mask(dests, border);
+            count += popCount64(sources & mids & ~blocked);
         }
-
-        calculateScore(currentPlayer);
-        calculateScore(opponentPlayer);
     }
+    return count;
 }
+#endif
 
-void redoMove(char **board, MoveStack *undoStack, MoveStack *redoStack, Player *currentPlayer, Player *opponentPlayer)
+int detectSimdLevel()
 {
-    if (!isMoveStackEmpty(redoStack))
+#if defined(SKIPPITY_X86_SIMD) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    int sse42 = (info[2] >> 20) & 1;
+    int osAvx = ((info[2] >> 27) & 1) && (_xgetbv(0) & 0x6) == 0x6;
+    int osAvx512 = osAvx && (_xgetbv(0) & 0xE6) == 0xE6;
+    __cpuidex(info, 7, 0);
+    if (osAvx512 && ((info[1] >> 16) & 1) && ((info[1] >> 30) & 1))
     {
-        Move move = popMove(redoStack);
-        pushMove(undoStack, move);
+        return SIMD_AVX512;
+    }
+    if (osAvx && ((info[1] >> 5) & 1))
+    {
+        return SIMD_AVX2;
+    }
+    if (sse42)
+    {
+        return SIMD_SSE42;
+    }
+#elif defined(SKIPPITY_X86_SIMD)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+    {
+        return SIMD_SSE42;
+    }
+#endif
+    return SIMD_SCALAR;
+}
 
-        board[move.destRow][move.destCol] = board[move.srcRow][move.srcCol];
-        board[move.srcRow][move.srcCol] = ' ';
+const char *simdLevelName(int level)
+{
+    const char *names[] = {"scalar", "SSE4.2", "AVX2", "AVX-512"};
+    return names[level];
+}
 
-        if (move.capturedPiece != ' ')
-        {
-            int midRow = (move.srcRow + move.destRow) / 2;
-            int midCol = (move.srcCol + move.destCol) / 2;
-            board[midRow][midCol] = ' ';
+int activeSimdLevel = SIMD_SCALAR;
+int (*countBoardJumpsKernel)(const Board *, int) = countBoardJumpsScalar;
 
-            currentPlayer->pieces[move.capturedPiece - 'A']++;
-        }
+void selectSimdKernels(int requestedLevel)
+{
+    int level = detectSimdLevel();
+    if (requestedLevel != SIMD_AUTO)
+    {
+        level = min(level, requestedLevel);
+    }
 
-        calculateScore(currentPlayer);
-        calculateScore(opponentPlayer);
+    activeSimdLevel = level;
+    countBoardJumpsKernel = countBoardJumpsScalar;
+#ifdef SKIPPITY_X86_SIMD
+    if (level == SIMD_SSE42)
+    {
+        countBoardJumpsKernel = countBoardJumpsSse42;
+    }
+    else if (level == SIMD_AVX2)
+    {
+        countBoardJumpsKernel = countBoardJumpsAvx2;
     }
+    else if (level == SIMD_AVX512)
+    {
+        countBoardJumpsKernel = countBoardJumpsAvx512;
+    }
+#endif
+}
+
+int countBoardJumps(const Board *board, int size)
+{
+    return countBoardJumpsKernel(board, size);
 }
 
-int analysePieces(char **board, int size, Player *currentPlayer, Player *opponentPlayer)
+void bitsetClearAll(Bitset *set)
 {
-    int score = currentPlayer->score - opponentPlayer->score;
+    memset(set->words, 0, sizeof(set->words));
+}
 
-    int setPotential = 0;
-    int minPieces = currentPlayer->pieces[0];
-    for (int i = 0; i < 5; i++)
+void bitsetSet(Bitset *set, int index)
+{
+    set->words[index >> 6] |= (uint64_t)1 << (index & 63);
+}
+
+void bitsetClear(Bitset *set, int index)
+{
+    set->words[index >> 6] &= ~((uint64_t)1 << (index & 63));
+}
+
+int bitsetTest(const Bitset *set, int index)
+{
+    return (set->words[index >> 6] >> (index & 63)) & 1;
+}
+
+uint64_t nextZobristValue(uint64_t *state)
+{
+    uint64_t value = (*state += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+void initZobrist()
+{
+    if (zobristReady)
+    {
+        return;
+    }
+
+    uint64_t state = 0x536B6970706974ULL;
+    for (int cell = 0; cell < MAX_CELLS; cell++)
+    {
+        for (int type = 0; type < 5; type++)
+        {
+            zobristCells[cell][type] = nextZobristValue(&state);
+        }
+    }
+    for (int player = 0; player < 2; player++)
     {
-        setPotential += currentPlayer->pieces[i];
-        if (currentPlayer->pieces[i] < minPieces)
+        for (int type = 0; type < 5; type++)
         {
-            minPieces = currentPlayer->pieces[i];
+            for (int count = 0; count <= MAX_CELLS; count++)
+            {
+                zobristPieces[player][type][count] = nextZobristValue(&state);
+            }
         }
     }
-    score += setPotential * 200;
-    score += minPieces * 400;
+    for (int size = 0; size <= MAX_SIZE; size++)
+    {
+        zobristSize[size] = nextZobristValue(&state);
+    }
+    for (int preset = 0; preset < SEARCH_PROFILES; preset++)
+    {
+        zobristPreset[preset] = nextZobristValue(&state);
+    }
+    zobristSide = nextZobristValue(&state);
+    zobristReady = 1;
+}
+
+void initJumpTables()
+{
+    if (jumpTablesReady)
+    {
+        return;
+    }
+    int deltaRows[4] = {-1, 0, 0, 1};
+    int deltaCols[4] = {0, -1, 1, 0};
 
-    int vulnerablePieces = 0;
-    for (int srcRow = 1; srcRow <= size; srcRow++)
+    for (int size = MIN_SIZE; size <= MAX_SIZE; size++)
     {
-        for (int srcCol = 1; srcCol <= size; srcCol++)
+        for (int cell = 0; cell < size * size; cell++)
         {
-            if (board[srcRow - 1][srcCol - 1] != ' ')
+            for (int direction = 0; direction < 4; direction++)
             {
-                for (int direction = -2; direction <= 2; direction += 4)
-                {
-                    int destRow = srcRow + direction;
-                    int destCol = srcCol;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[(srcRow + destRow) / 2 - 1][destCol - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                    destRow = srcRow;
-                    destCol = srcCol + direction;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[destRow - 1][(srcCol + destCol) / 2 - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                }
+                JumpEdge *edge = &jumpEdges[size][cell][direction];
+                int midRow = cell / size + deltaRows[direction];
+                int midCol = cell % size + deltaCols[direction];
+                int destRow = midRow + deltaRows[direction];
+                int destCol = midCol + deltaCols[direction];
+
+                edge->mid = midRow >= 0 && midRow < size && midCol >= 0 && midCol < size ? midRow * size + midCol : -1;
+                edge->dest = destRow >= 0 && destRow < size && destCol >= 0 && destCol < size ? destRow * size + destCol : -1;
             }
         }
     }
-    score -= vulnerablePieces * 10;
+    jumpTablesReady = 1;
+}
+
+uint64_t playerKey(const Player *player, int playerIndex)
+{
+    uint64_t key = 0;
+    for (int type = 0; type < 5; type++)
+    {
+        key ^= zobristPieces[playerIndex][type][player->pieces[type]];
+    }
+    return key;
+}
 
-    int opponentSetPotential = 0;
-    int opponentMinPieces = opponentPlayer->pieces[0];
-    for (int i = 0; i < 5; i++)
+void addCapture(Player *player, int type)
+{
+    player->extraPieces++;
+    if (player->pieces[type]++ == player->sets && --player->typesAtMin == 0)
     {
-        opponentSetPotential += opponentPlayer->pieces[i];
-        if (opponentPlayer->pieces[i] < opponentMinPieces)
+        player->sets++;
+        player->extraPieces -= 5;
+        for (int i = 0; i < 5; i++)
         {
-            opponentMinPieces = opponentPlayer->pieces[i];
+            if (player->pieces[i] == player->sets)
+            {
+                player->typesAtMin++;
+            }
         }
     }
-    score -= opponentSetPotential * 200;
-    score -= opponentMinPieces * 400;
+    player->score = player->sets * 100 + player->extraPieces;
+}
 
-    score += currentPlayer->extraPieces * 10;
+void removeCapture(Player *player, int type)
+{
+    player->extraPieces--;
+    int count = --player->pieces[type];
+    if (count < player->sets)
+    {
+        player->sets = count;
+        player->extraPieces += 5;
+        player->typesAtMin = 1;
+    }
+    else if (count == player->sets)
+    {
+        player->typesAtMin++;
+    }
+    player->score = player->sets * 100 + player->extraPieces;
+}
 
-    int capturedPieces = 0;
-    for (int i = 0; i < 5; i++)
+void updatePieceCount(SearchBoard *searchBoard, Player *player, int playerIndex, int type, int delta)
+{
+    searchBoard->key ^= zobristPieces[playerIndex][type][player->pieces[type]];
+    if (delta > 0)
     {
-        capturedPieces += currentPlayer->pieces[i] - opponentPlayer->pieces[i];
+        addCapture(player, type);
     }
-    score += capturedPieces * 100;
+    else
+    {
+        removeCapture(player, type);
+    }
+    searchBoard->key ^= zobristPieces[playerIndex][type][player->pieces[type]];
+}
+
+void loadEngineConfig()
+{
+    char *value = getenv("SKIPPITY_TT_MB");
+    if (value != NULL && atoi(value) > 0)
+    {
+        engineConfig.ttSizeMb = atoi(value);
+    }
+    value = getenv("SKIPPITY_TT_FILE");
+    if (value != NULL && value[0] != '\0')
+    {
+        engineConfig.ttFile = value;
+    }
+    value = getenv("SKIPPITY_HUGE_PAGES");
+    if (value != NULL)
+    {
+        engineConfig.hugePages = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_MOVE_TIME_MS");
+    if (value != NULL && atoi(value) >= 0)
+    {
+        engineConfig.moveTimeMs = atoi(value);
+    }
+    value = getenv("SKIPPITY_THREADS");
+    if (value != NULL && atoi(value) > 0)
+    {
+        engineConfig.threads = min(atoi(value), MAX_THREADS);
+    }
+    value = getenv("SKIPPITY_LAZY_SMP");
+    if (value != NULL)
+    {
+        engineConfig.lazySmp = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_MOVE_HEURISTICS");
+    if (value != NULL)
+    {
+        engineConfig.moveHeuristics = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_SIZE_KERNELS");
+    if (value != NULL)
+    {
+        engineConfig.sizeKernels = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_SIMD");
+    if (value != NULL)
+    {
+        const char *levels[] = {"scalar", "sse4.2", "avx2", "avx512"};
+        for (int level = SIMD_SCALAR; level <= SIMD_AVX512; level++)
+        {
+            if (strcmp(value, levels[level]) == 0)
+            {
+                engineConfig.simdLevel = level;
+            }
+        }
+    }
+    value = getenv("SKIPPITY_ASPIRATION");
+    if (value != NULL && atoi(value) >= 0)
+    {
+        engineConfig.aspirationWindow = atoi(value);
+    }
+    value = getenv("SKIPPITY_LMR");
+    if (value != NULL)
+    {
+        engineConfig.lateMoveReductions = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_LMR_MOVES");
+    if (value != NULL && atoi(value) > 0)
+    {
+        engineConfig.lateMoveIndex = atoi(value);
+    }
+    value = getenv("SKIPPITY_FUTILITY");
+    if (value != NULL)
+    {
+        engineConfig.futilityPruning = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_FUTILITY_MARGIN");
+    if (value != NULL && atoi(value) >= 0)
+    {
+        engineConfig.futilityMargin = atoi(value);
+    }
+    value = getenv("SKIPPITY_SCORE_BOUNDS");
+    if (value != NULL)
+    {
+        engineConfig.scoreBounds = atoi(value) != 0;
+    }
+    value = getenv("SKIPPITY_MULTI_PV");
+    if (value != NULL && atoi(value) > 0)
+    {
+        engineConfig.multiPv = min(atoi(value), MAX_MULTI_PV);
+    }
+    selectSimdKernels(engineConfig.simdLevel);
+}
+
+int onlineProcessors()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+void freeTranspositionTable(TranspositionTable *table)
+{
+    if (table->buckets == NULL)
+    {
+        return;
+    }
+#ifdef _WIN32
+    _aligned_free(table->buckets);
+#else
+    if (table->file != NULL)
+    {
+        msync(table->file, TT_FILE_HEADER_BYTES, MS_SYNC);
+        munmap(table->file, TT_FILE_HEADER_BYTES + table->bytes);
+        table->file = NULL;
+    }
+    else if (table->mapped)
+    {
+        munmap(table->buckets, table->bytes);
+    }
+    else
+    {
+        free(table->buckets);
+    }
+#endif
+    table->buckets = NULL;
+    table->mapped = 0;
+}
+
+uint64_t ttFileChecksum(const TTFileHeader *header)
+{
+    uint64_t state = header->magic ^ ((uint64_t)header->version << 32 | header->maxSize);
+    uint64_t checksum = nextZobristValue(&state);
+    state ^= header->bucketCount;
+    return checksum ^ nextZobristValue(&state);
+}
+
+#ifndef _WIN32
+int mapTranspositionFile(TranspositionTable *table, const char *path, size_t bucketCount)
+{
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    flock(fd, LOCK_EX);
+
+    TTFileHeader header;
+    struct stat info;
+    int valid = fstat(fd, &info) == 0 && info.st_size >= TT_FILE_HEADER_BYTES &&
+                pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+                header.magic == TT_FILE_MAGIC && header.version == TT_FILE_VERSION && header.maxSize == MAX_SIZE &&
+                header.checksum == ttFileChecksum(&header) && header.bucketCount > 0 && (header.bucketCount & (header.bucketCount - 1)) == 0 &&
+                (uint64_t)info.st_size == TT_FILE_HEADER_BYTES + header.bucketCount * sizeof(TTBucket);
+    if (valid)
+    {
+        bucketCount = header.bucketCount;
+    }
+    else if (ftruncate(fd, 0) != 0 || ftruncate(fd, TT_FILE_HEADER_BYTES + bucketCount * sizeof(TTBucket)) != 0)
+    {
+        flock(fd, LOCK_UN);
+        close(fd);
+        return 0;
+    }
+
+    size_t bytes = bucketCount * sizeof(TTBucket);
+    void *memory = mmap(NULL, TT_FILE_HEADER_BYTES + bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED)
+    {
+        flock(fd, LOCK_UN);
+        close(fd);
+        return 0;
+    }
+
+    TTFileHeader *file = (TTFileHeader *)memory;
+    if (!valid)
+    {
+        file->magic = TT_FILE_MAGIC;
+        file->version = TT_FILE_VERSION;
+        file->maxSize = MAX_SIZE;
+        file->bucketCount = bucketCount;
+        atomic_store(&file->generation, 0);
+        file->checksum = ttFileChecksum(file);
+        msync(memory, TT_FILE_HEADER_BYTES, MS_SYNC);
+    }
+    flock(fd, LOCK_UN);
+    close(fd);
+
+    table->file = file;
+    table->buckets = (TTBucket *)((char *)memory + TT_FILE_HEADER_BYTES);
+    table->bytes = bytes;
+    table->bucketMask = bucketCount - 1;
+    table->generation = (int)atomic_load(&file->generation);
+    return 1;
+}
+#endif
+
+int initTranspositionTable(TranspositionTable *table, int sizeMb, int hugePages, const char *path)
+{
+    size_t bucketCount = 1;
+    while (bucketCount * 2 * sizeof(TTBucket) <= (size_t)sizeMb * 1024 * 1024)
+    {
+        bucketCount *= 2;
+    }
+
+    table->bytes = bucketCount * sizeof(TTBucket);
+    table->bucketMask = bucketCount - 1;
+    table->generation = 0;
+    table->mapped = 0;
+    table->buckets = NULL;
+    table->file = NULL;
+
+#ifdef _WIN32
+    table->buckets = (TTBucket *)_aligned_malloc(table->bytes, 64);
+#else
+    if (path != NULL && mapTranspositionFile(table, path, bucketCount))
+    {
+        return 1;
+    }
+#ifdef MAP_HUGETLB
+    if (hugePages)
+    {
+        void *memory = mmap(NULL, table->bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            table->buckets = (TTBucket *)memory;
+            table->mapped = 1;
+        }
+    }
+#endif
+    if (table->buckets == NULL)
+    {
+        void *memory = NULL;
+        size_t alignment = (hugePages && table->bytes >= 2 * 1024 * 1024) ? 2 * 1024 * 1024 : 64;
+        if (posix_memalign(&memory, alignment, table->bytes) == 0)
+        {
+            table->buckets = (TTBucket *)memory;
+#ifdef MADV_HUGEPAGE
+            if (hugePages)
+            {
+                madvise(memory, table->bytes, MADV_HUGEPAGE);
+            }
+#endif
+        }
+    }
+#endif
+
+    if (table->buckets == NULL)
+    {
+        return 0;
+    }
+    memset(table->buckets, 0, table->bytes);
+    return 1;
+}
+
+void clearTranspositionTable(TranspositionTable *table)
+{
+    if (table->buckets != NULL)
+    {
+        memset(table->buckets, 0, table->bytes);
+    }
+    table->generation = 0;
+}
+
+void advanceTranspositionTable(TranspositionTable *table)
+{
+    if (table->file != NULL)
+    {
+        table->generation = (int)atomic_fetch_add(&table->file->generation, 1) + 1;
+    }
+    else
+    {
+        table->generation++;
+    }
+}
+
+uint64_t packTTData(int score, int move, int depth, int bound, int generation)
+{
+    return (uint64_t)(uint32_t)score | ((uint64_t)move << 32) | ((uint64_t)min(depth, 127) << 52) |
+           ((uint64_t)bound << 59) | ((uint64_t)(generation & 7) << 61);
+}
+
+int probeTranspositionTable(TranspositionTable *table, uint64_t key, int *score, int *move, int *depth, int *bound)
+{
+    if (table->buckets == NULL)
+    {
+        return 0;
+    }
+
+    TTBucket *bucket = &table->buckets[key & table->bucketMask];
+    for (int i = 0; i < TT_BUCKET_ENTRIES; i++)
+    {
+        uint64_t data = atomic_load_explicit(&bucket->entries[i].data, memory_order_relaxed);
+        if (data != 0 && (atomic_load_explicit(&bucket->entries[i].key, memory_order_relaxed) ^ data) == key)
+        {
+            *score = (int32_t)(uint32_t)data;
+            *move = (int)((data >> 32) & TT_NO_MOVE);
+            *depth = (int)((data >> 52) & 127);
+            *bound = (int)((data >> 59) & 3);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void storeTranspositionTable(TranspositionTable *table, uint64_t key, int score, int move, int depth, int bound)
+{
+    if (table->buckets == NULL)
+    {
+        return;
+    }
+
+    TTBucket *bucket = &table->buckets[key & table->bucketMask];
+    TTEntry *replace = &bucket->entries[0];
+    int replaceValue = INT_MAX;
+
+    for (int i = 0; i < TT_BUCKET_ENTRIES; i++)
+    {
+        TTEntry *entry = &bucket->entries[i];
+        uint64_t entryData = atomic_load_explicit(&entry->data, memory_order_relaxed);
+        if (entryData == 0 || (atomic_load_explicit(&entry->key, memory_order_relaxed) ^ entryData) == key)
+        {
+            replace = entry;
+            break;
+        }
+
+        int entryDepth = (int)((entryData >> 52) & 127);
+        int entryGeneration = (int)(entryData >> 61);
+        int value = entryDepth - (entryGeneration == (table->generation & 7) ? 0 : 256);
+        if (value < replaceValue)
+        {
+            replace = entry;
+            replaceValue = value;
+        }
+    }
+
+    uint64_t oldData = atomic_load_explicit(&replace->data, memory_order_relaxed);
+    if (move == TT_NO_MOVE && oldData != 0 && (atomic_load_explicit(&replace->key, memory_order_relaxed) ^ oldData) == key)
+    {
+        move = (int)((oldData >> 32) & TT_NO_MOVE);
+    }
+    uint64_t data = packTTData(score, move, depth, bound, table->generation);
+    atomic_store_explicit(&replace->key, key ^ data, memory_order_relaxed);
+    atomic_store_explicit(&replace->data, data, memory_order_relaxed);
+}
+
+void pushEmptyCell(SearchBoard *searchBoard, int cell)
+{
+    searchBoard->emptySlot[cell] = searchBoard->emptyCount;
+    searchBoard->emptyCells[searchBoard->emptyCount++] = cell;
+}
+
+void removeEmptyCell(SearchBoard *searchBoard, int cell)
+{
+    int slot = searchBoard->emptySlot[cell];
+    int last = searchBoard->emptyCells[--searchBoard->emptyCount];
+    searchBoard->emptyCells[slot] = last;
+    searchBoard->emptySlot[last] = slot;
+}
+
+void restoreEmptyCell(SearchBoard *searchBoard, int cell, int slot)
+{
+    int moved = searchBoard->emptyCells[slot];
+    searchBoard->emptySlot[moved] = searchBoard->emptyCount;
+    searchBoard->emptyCells[searchBoard->emptyCount++] = moved;
+    searchBoard->emptyCells[slot] = cell;
+    searchBoard->emptySlot[cell] = slot;
+}
+
+char pieceAt(const SearchBoard *searchBoard, int cell)
+{
+    if (!bitsetTest(&searchBoard->occupied, cell))
+    {
+        return ' ';
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        if (bitsetTest(&searchBoard->pieces[i], cell))
+        {
+            return 'A' + i;
+        }
+    }
+    return 'E';
+}
+
+void initSearchBoard(SearchBoard *searchBoard, Board *board, int size)
+{
+    initZobrist();
+    initJumpTables();
+    searchBoard->size = size;
+    searchBoard->edges = (const JumpEdge(*)[4])jumpEdges[size];
+    searchBoard->key = zobristSize[size];
+    bitsetClearAll(&searchBoard->occupied);
+    for (int i = 0; i < 5; i++)
+    {
+        bitsetClearAll(&searchBoard->pieces[i]);
+        searchBoard->pieceCounts[i] = 0;
+    }
+    searchBoard->emptyCount = 0;
+
+    for (int row = 0; row < size; row++)
+    {
+        for (int col = 0; col < size; col++)
+        {
+            int cell = row * size + col;
+            char piece = getCell(board, row, col);
+            if (isPieceCell(piece))
+            {
+                bitsetSet(&searchBoard->occupied, cell);
+                bitsetSet(&searchBoard->pieces[piece - 'A'], cell);
+                searchBoard->pieceCounts[piece - 'A']++;
+                searchBoard->key ^= zobristCells[cell][piece - 'A'];
+            }
+            else
+            {
+                pushEmptyCell(searchBoard, cell);
+            }
+        }
+    }
+    searchBoard->legalJumps = countBoardJumps(board, size);
+}
+
+int segmentJumps(const SearchBoard *searchBoard, int start, int mid, int end)
+{
+    return bitsetTest(&searchBoard->occupied, mid) && bitsetTest(&searchBoard->occupied, start) != bitsetTest(&searchBoard->occupied, end);
+}
+
+FORCE_INLINE int countCrossJumps(const SearchBoard *searchBoard, int cell, int side, int size)
+{
+    const JumpEdge *edges = jumpEdges[size][cell];
+    int count = 0;
+
+    if (edges[side].dest >= 0)
+    {
+        count += segmentJumps(searchBoard, cell, edges[side].mid, edges[side].dest);
+    }
+    if (edges[3 - side].dest >= 0)
+    {
+        count += segmentJumps(searchBoard, cell, edges[3 - side].mid, edges[3 - side].dest);
+    }
+    if (edges[side].mid >= 0 && edges[3 - side].mid >= 0)
+    {
+        count += segmentJumps(searchBoard, edges[side].mid, cell, edges[3 - side].mid);
+    }
+    return count;
+}
+
+FORCE_INLINE int jumpDirection(int size, int src, int dest)
+{
+    int step = (dest - src) / 2;
+    if (step == -size)
+    {
+        return 0;
+    }
+    if (step == -1)
+    {
+        return 1;
+    }
+    return step == 1 ? 2 : 3;
+}
+
+FORCE_INLINE int countJumpsAround(const SearchBoard *searchBoard, int src, int dest, int size)
+{
+    int direction = jumpDirection(size, src, dest);
+    const JumpEdge *back = &jumpEdges[size][src][3 - direction];
+    const JumpEdge *ahead = &jumpEdges[size][dest][direction];
+    int mid = jumpEdges[size][src][direction].mid;
+    int side = direction == 0 || direction == 3 ? 1 : 0;
+
+    int count = segmentJumps(searchBoard, src, mid, dest);
+    if (back->mid >= 0)
+    {
+        count += segmentJumps(searchBoard, back->mid, src, mid);
+        if (back->dest >= 0)
+        {
+            count += segmentJumps(searchBoard, back->dest, back->mid, src);
+        }
+    }
+    if (ahead->mid >= 0)
+    {
+        count += segmentJumps(searchBoard, mid, dest, ahead->mid);
+        if (ahead->dest >= 0)
+        {
+            count += segmentJumps(searchBoard, dest, ahead->mid, ahead->dest);
+        }
+    }
+    count += countCrossJumps(searchBoard, src, side, size);
+    count += countCrossJumps(searchBoard, mid, side, size);
+    count += countCrossJumps(searchBoard, dest, side, size);
+    return count;
+}
+
+FORCE_INLINE JumpUndo applyJump(SearchBoard *searchBoard, int src, int dest, int size)
+{
+    int mid = (src + dest) / 2;
+    char piece = pieceAt(searchBoard, src);
+    char capturedPiece = pieceAt(searchBoard, mid);
+    JumpUndo undo = {capturedPiece, searchBoard->emptySlot[dest], -countJumpsAround(searchBoard, src, dest, size)};
+
+    bitsetClear(&searchBoard->occupied, src);
+    bitsetClear(&searchBoard->pieces[piece - 'A'], src);
+    bitsetClear(&searchBoard->occupied, mid);
+    bitsetClear(&searchBoard->pieces[capturedPiece - 'A'], mid);
+    searchBoard->pieceCounts[capturedPiece - 'A']--;
+    bitsetSet(&searchBoard->occupied, dest);
+    bitsetSet(&searchBoard->pieces[piece - 'A'], dest);
+
+    searchBoard->key ^= zobristCells[src][piece - 'A'] ^ zobristCells[dest][piece - 'A'] ^ zobristCells[mid][capturedPiece - 'A'];
+
+    removeEmptyCell(searchBoard, dest);
+    pushEmptyCell(searchBoard, src);
+    pushEmptyCell(searchBoard, mid);
+
+    undo.legalJumpsDelta += countJumpsAround(searchBoard, src, dest, size);
+    searchBoard->legalJumps += undo.legalJumpsDelta;
+    return undo;
+}
+
+void undoJump(SearchBoard *searchBoard, int src, int dest, JumpUndo undo)
+{
+    int mid = (src + dest) / 2;
+    char piece = pieceAt(searchBoard, dest);
+    char capturedPiece = undo.capturedPiece;
+
+    bitsetClear(&searchBoard->occupied, dest);
+    bitsetClear(&searchBoard->pieces[piece - 'A'], dest);
+    bitsetSet(&searchBoard->occupied, mid);
+    bitsetSet(&searchBoard->pieces[capturedPiece - 'A'], mid);
+    searchBoard->pieceCounts[capturedPiece - 'A']++;
+    bitsetSet(&searchBoard->occupied, src);
+    bitsetSet(&searchBoard->pieces[piece - 'A'], src);
+
+    searchBoard->key ^= zobristCells[src][piece - 'A'] ^ zobristCells[dest][piece - 'A'] ^ zobristCells[mid][capturedPiece - 'A'];
+
+    searchBoard->emptyCount -= 2;
+    restoreEmptyCell(searchBoard, dest, undo.destSlot);
+    searchBoard->legalJumps -= undo.legalJumpsDelta;
+}
+
+FORCE_INLINE JumpUndo makeJump(SearchBoard *searchBoard, Player *player, int playerIndex, int src, int dest, int size)
+{
+    JumpUndo undo = applyJump(searchBoard, src, dest, size);
+    updatePieceCount(searchBoard, player, playerIndex, undo.capturedPiece - 'A', 1);
+    return undo;
+}
+
+void unmakeJump(SearchBoard *searchBoard, Player *player, int playerIndex, int src, int dest, JumpUndo undo)
+{
+    undoJump(searchBoard, src, dest, undo);
+    updatePieceCount(searchBoard, player, playerIndex, undo.capturedPiece - 'A', -1);
+}
+
+void switchSide(SearchBoard *searchBoard, GameState *state)
+{
+    state->sideToMove ^= 1;
+    searchBoard->key ^= zobristSide;
+}
+
+void storeJump(Board *board, const SearchBoard *searchBoard, int src, int dest)
+{
+    int cells[3] = {src, (src + dest) / 2, dest};
+
+    for (int i = 0; i < 3; i++)
+    {
+        setCell(board, cells[i] / board->size, cells[i] % board->size, pieceAt(searchBoard, cells[i]));
+    }
+}
+
+void playMove(Board *board, Player *player, Move *move)
+{
+    SearchBoard searchBoard;
+    int src = move->srcRow * board->size + move->srcCol;
+    int dest = move->destRow * board->size + move->destCol;
+
+    initSearchBoard(&searchBoard, board, board->size);
+    move->undo = makeJump(&searchBoard, player, 0, src, dest, board->size);
+    storeJump(board, &searchBoard, src, dest);
+}
+
+void takeBackMove(Board *board, Player *player, Move move)
+{
+    SearchBoard searchBoard;
+    int src = move.srcRow * board->size + move.srcCol;
+    int dest = move.destRow * board->size + move.destCol;
+
+    initSearchBoard(&searchBoard, board, board->size);
+    removeEmptyCell(&searchBoard, src);
+    removeEmptyCell(&searchBoard, (src + dest) / 2);
+    pushEmptyCell(&searchBoard, src);
+    pushEmptyCell(&searchBoard, (src + dest) / 2);
+    move.undo.destSlot = searchBoard.emptyCount - 2;
+    unmakeJump(&searchBoard, player, 0, src, dest, move.undo);
+    storeJump(board, &searchBoard, src, dest);
+}
+
+int encodeMove(JumpMove move)
+{
+    uint64_t state = (uint64_t)move.src | (uint64_t)move.length << 16;
+    state = nextZobristValue(&state) ^ move.path;
+    return (int)(nextZobristValue(&state) % TT_NO_MOVE);
+}
+
+int canJump(const SearchBoard *searchBoard, int cell, int direction)
+{
+    const JumpEdge *edge = &searchBoard->edges[cell][direction];
+    return edge->dest >= 0 && bitsetTest(&searchBoard->occupied, edge->mid) && !bitsetTest(&searchBoard->occupied, edge->dest);
+}
+
+int markChainSeen(uint64_t *seenKeys, uint64_t key)
+{
+    for (int i = 0; i < CHAIN_SEEN_SLOTS; i++)
+    {
+        uint64_t *slot = &seenKeys[(key + i) & (CHAIN_SEEN_SLOTS - 1)];
+        if (*slot == key)
+        {
+            return 0;
+        }
+        if (*slot == 0)
+        {
+            *slot = key;
+            return 1;
+        }
+    }
+    return 1;
+}
+
+void addChainMoves(SearchBoard *searchBoard, MoveList *moveList, int src, int cell, int direction, int type, int length, uint64_t path, uint64_t *seenKeys)
+{
+    int mid = searchBoard->edges[cell][direction].mid;
+    int dest = searchBoard->edges[cell][direction].dest;
+    uint64_t toggle = zobristCells[cell][type] ^ zobristCells[dest][type] ^ zobristCells[mid][pieceAt(searchBoard, mid) - 'A'];
+
+    path |= (uint64_t)direction << (2 * length);
+    length++;
+
+    bitsetClear(&searchBoard->occupied, cell);
+    bitsetClear(&searchBoard->occupied, mid);
+    bitsetSet(&searchBoard->occupied, dest);
+    searchBoard->key ^= toggle;
+
+    if (length < 3 || markChainSeen(seenKeys, searchBoard->key))
+    {
+        JumpMove *move = &moveList->moves[moveList->count++];
+        move->src = src;
+        move->dest = dest;
+        move->length = length;
+        move->path = path;
+
+        for (int next = 0; next < 4 && length < MAX_CHAIN && moveList->count < MAX_MOVES; next++)
+        {
+            if (canJump(searchBoard, dest, next))
+            {
+                addChainMoves(searchBoard, moveList, src, dest, next, type, length, path, seenKeys);
+            }
+        }
+    }
+
+    searchBoard->key ^= toggle;
+    bitsetClear(&searchBoard->occupied, dest);
+    bitsetSet(&searchBoard->occupied, mid);
+    bitsetSet(&searchBoard->occupied, cell);
+}
+
+FORCE_INLINE void generateMovesKernel(SearchBoard *searchBoard, MoveList *moveList, int size)
+{
+    uint64_t seenKeys[CHAIN_SEEN_SLOTS];
+    memset(seenKeys, 0, sizeof(seenKeys));
+    moveList->count = 0;
+
+    for (int i = 0; i < searchBoard->emptyCount && moveList->count < MAX_MOVES; i++)
+    {
+        const JumpEdge *edges = jumpEdges[size][searchBoard->emptyCells[i]];
+
+        for (int direction = 0; direction < 4 && moveList->count < MAX_MOVES; direction++)
+        {
+            int src = edges[direction].dest;
+            if (src >= 0 && bitsetTest(&searchBoard->occupied, edges[direction].mid) && bitsetTest(&searchBoard->occupied, src))
+            {
+                addChainMoves(searchBoard, moveList, src, src, 3 - direction, pieceAt(searchBoard, src) - 'A', 0, 0, seenKeys);
+            }
+        }
+    }
+}
+
+FORCE_INLINE void applyChainKernel(SearchBoard *searchBoard, JumpMove move, GameState *state, JumpUndo *undo, int size)
+{
+    Player *player = &state->players[state->sideToMove];
+    int cell = move.src;
+    for (int i = 0; i < move.length; i++)
+    {
+        int next = jumpEdges[size][cell][(move.path >> (2 * i)) & 3].dest;
+        undo[i] = makeJump(searchBoard, player, state->sideToMove, cell, next, size);
+        cell = next;
+    }
+    switchSide(searchBoard, state);
+}
+
+FORCE_INLINE void undoChainKernel(SearchBoard *searchBoard, JumpMove move, GameState *state, const JumpUndo *undo, int size)
+{
+    switchSide(searchBoard, state);
+    int cells[MAX_CHAIN + 1];
+    cells[0] = move.src;
+    for (int i = 0; i < move.length; i++)
+    {
+        cells[i + 1] = jumpEdges[size][cells[i]][(move.path >> (2 * i)) & 3].dest;
+    }
+    for (int i = move.length - 1; i >= 0; i--)
+    {
+        unmakeJump(searchBoard, &state->players[state->sideToMove], state->sideToMove, cells[i], cells[i + 1], undo[i]);
+    }
+}
+
+void generateMoves(SearchBoard *searchBoard, MoveList *moveList)
+{
+    generateMovesKernel(searchBoard, moveList, searchBoard->size);
+}
+
+void applyChain(SearchBoard *searchBoard, JumpMove move, GameState *state, JumpUndo *undo)
+{
+    applyChainKernel(searchBoard, move, state, undo, searchBoard->size);
+}
+
+void undoChain(SearchBoard *searchBoard, JumpMove move, GameState *state, const JumpUndo *undo)
+{
+    undoChainKernel(searchBoard, move, state, undo, searchBoard->size);
+}
+
+void calculateScore(Player *player)
+{
+    int minPieces = player->pieces[0];
+
+    for (int i = 1; i < 5; i++)
+    {
+        if (player->pieces[i] < minPieces)
+        {
+            minPieces = player->pieces[i];
+        }
+    }
+
+    player->sets = minPieces;
+
+    player->extraPieces = 0;
+    player->typesAtMin = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        player->extraPieces += player->pieces[i] - minPieces;
+        if (player->pieces[i] == minPieces)
+        {
+            player->typesAtMin++;
+        }
+    }
+
+    player->score = player->sets * 100 + player->extraPieces;
+}
+
+Player playerAfterChain(const SearchBoard *searchBoard, JumpMove move, const Player *player)
+{
+    Player after = *player;
+    int cell = move.src;
+    for (int i = 0; i < move.length; i++)
+    {
+        const JumpEdge *edge = &searchBoard->edges[cell][(move.path >> (2 * i)) & 3];
+        addCapture(&after, pieceAt(searchBoard, edge->mid) - 'A');
+        cell = edge->dest;
+    }
+    return after;
+}
+
+int chainGain(const SearchBoard *searchBoard, JumpMove move, const Player *player)
+{
+    return playerAfterChain(searchBoard, move, player).score - player->score;
+}
+
+void orderMoves(const SearchBoard *searchBoard, MoveList *moveList, const Player *capturer, int ttMove, const SearchHeuristics *heuristics, int ply)
+{
+    int scores[MAX_MOVES];
+
+    for (int i = 0; i < moveList->count; i++)
+    {
+        JumpMove move = moveList->moves[i];
+        int code = encodeMove(move);
+        int score = min(chainGain(searchBoard, move, capturer), 900);
+        if (heuristics != NULL)
+        {
+            if (code == heuristics->killers[ply][0])
+            {
+                score += 60;
+            }
+            else if (code == heuristics->killers[ply][1])
+            {
+                score += 55;
+            }
+            score = (score << 20) | heuristics->history[move.src][move.path & 3];
+        }
+        if (code == ttMove)
+        {
+            score = INT_MAX;
+        }
+
+        int j = i;
+        while (j > 0 && scores[j - 1] < score)
+        {
+            scores[j] = scores[j - 1];
+            moveList->moves[j] = moveList->moves[j - 1];
+            j--;
+        }
+        scores[j] = score;
+        moveList->moves[j] = move;
+    }
+}
+
+void undoMove(Board *board, MoveStack *undoStack, MoveStack *redoStack, Player *currentPlayer)
+{
+    if (!isMoveStackEmpty(undoStack))
+    {
+        Move move = popMove(undoStack);
+        pushMove(redoStack, move);
+        takeBackMove(board, currentPlayer, move);
+    }
+}
+
+void redoMove(Board *board, MoveStack *undoStack, MoveStack *redoStack, Player *currentPlayer)
+{
+    if (!isMoveStackEmpty(redoStack))
+    {
+        Move move = popMove(redoStack);
+        playMove(board, currentPlayer, &move);
+        pushMove(undoStack, move);
+    }
+}
+
+int piecesHeld(const Player *player)
+{
+    return player->sets * 5 + player->extraPieces;
+}
+
+int materialValue(const Player *player, const EvalWeights *weights)
+{
+    return player->score + piecesHeld(player) * weights->held + player->sets * weights->sets + player->extraPieces * weights->extraPieces;
+}
+
+int chainValue(const SearchBoard *searchBoard, JumpMove move, const Player *player, const EvalWeights *weights)
+{
+    Player after = playerAfterChain(searchBoard, move, player);
+    return materialValue(&after, weights) - materialValue(player, weights);
+}
+
+int materialWithCaptures(const Player *player, const int *captures, const EvalWeights *weights)
+{
+    Player after = *player;
+    for (int i = 0; i < 5; i++)
+    {
+        after.pieces[i] += captures[i];
+    }
+    calculateScore(&after);
+    return materialValue(&after, weights);
+}
+
+FORCE_INLINE int evaluatePosition(const SearchBoard *searchBoard, const GameState *state, const EvalWeights *weights)
+{
+    const Player *player = &state->players[state->sideToMove];
+    const Player *opponent = &state->players[!state->sideToMove];
+
+    return materialValue(player, weights) - materialValue(opponent, weights) + searchBoard->legalJumps * weights->vulnerable;
+}
+
+FORCE_INLINE void scoreBounds(const SearchBoard *searchBoard, const GameState *state, const EvalWeights *weights, int *lower, int *upper)
+{
+    const Player *player = &state->players[state->sideToMove];
+    const Player *opponent = &state->players[!state->sideToMove];
+    int remaining = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        remaining += searchBoard->pieceCounts[i];
+    }
+    int jumpRange = 4 * remaining * weights->vulnerable;
+
+    *upper = materialWithCaptures(player, searchBoard->pieceCounts, weights) - materialValue(opponent, weights) + jumpRange;
+    *lower = materialValue(player, weights) - materialWithCaptures(opponent, searchBoard->pieceCounts, weights) - jumpRange;
+}
+
+int canJumpFrom(Board *board, int row, int col)
+{
+    return canJumpToward(board, row, col, -BOARD_STRIDE) || canJumpToward(board, row, col, -1) ||
+           canJumpToward(board, row, col, 1) || canJumpToward(board, row, col, BOARD_STRIDE);
+}
+
+int isGameOver(const SearchBoard *searchBoard)
+{
+    return searchBoard->legalJumps == 0;
+}
+
+int checkGameOver(Board *board, int size)
+{
+    return countBoardJumps(board, size) == 0;
+}
+
+void ageSearchHeuristics(EngineContext *engine, int plies)
+{
+    for (int slot = 0; slot < MAX_THREADS; slot++)
+    {
+        for (int ply = 0; ply < MAX_PLY; ply++)
+        {
+            int from = ply + plies;
+            engine->heuristics[slot].killers[ply][0] = from < MAX_PLY ? engine->heuristics[slot].killers[from][0] : TT_NO_MOVE;
+            engine->heuristics[slot].killers[ply][1] = from < MAX_PLY ? engine->heuristics[slot].killers[from][1] : TT_NO_MOVE;
+        }
+        for (int cell = 0; cell < MAX_CELLS; cell++)
+        {
+            for (int direction = 0; direction < 4; direction++)
+            {
+                engine->heuristics[slot].history[cell][direction] >>= 2;
+            }
+        }
+    }
+}
+
+void clearEngineContext(EngineContext *engine, int sizeMb, const char *path)
+{
+    if (engine->table.buckets == NULL)
+    {
+        initTranspositionTable(&engine->table, sizeMb, engineConfig.hugePages, path);
+    }
+    else if (engine->table.file == NULL)
+    {
+        clearTranspositionTable(&engine->table);
+    }
+    memset(engine->heuristics, 0, sizeof(engine->heuristics));
+    ageSearchHeuristics(engine, MAX_PLY);
+    memset(engine->predictions, 0, sizeof(engine->predictions));
+    engine->nextPrediction = 0;
+    engine->predictedHits = 0;
+}
+
+void freeEngineContext()
+{
+    freeTranspositionTable(&engineContext.table);
+    freeTranspositionTable(&secondEngineContext.table);
+    freeTranspositionTable(&hintContext.table);
+}
+
+void resetEngineContext()
+{
+    if (engineContext.table.buckets == NULL && hintContext.table.buckets == NULL)
+    {
+        atexit(freeEngineContext);
+    }
+    clearEngineContext(&engineContext, engineConfig.ttSizeMb, engineConfig.ttFile);
+    clearEngineContext(&secondEngineContext, engineConfig.ttSizeMb, engineConfig.ttFile);
+    clearEngineContext(&hintContext, HINT_TT_MB, NULL);
+}
+
+int predictedMove(const EngineContext *engine, uint64_t key)
+{
+    for (int i = 0; i < ENGINE_PREDICTIONS; i++)
+    {
+        if (engine->predictions[i].key == key && engine->predictions[i].move != TT_NO_MOVE)
+        {
+            return engine->predictions[i].move;
+        }
+    }
+    return TT_NO_MOVE;
+}
+
+void recordCutoff(SearchContext *context, JumpMove move, int moveIndex, int depth)
+{
+    int code = encodeMove(move);
+
+    context->stats.cutoffs++;
+    if (moveIndex == 0)
+    {
+        context->stats.firstMoveCutoffs++;
+    }
+    if (context->heuristics == NULL)
+    {
+        return;
+    }
+
+    int *killers = context->heuristics->killers[context->ply];
+    if (code == killers[0] || code == killers[1])
+    {
+        context->stats.killerCutoffs++;
+    }
+    if (code != killers[0])
+    {
+        killers[1] = killers[0];
+        killers[0] = code;
+    }
+
+    int *history = &context->heuristics->history[move.src][move.path & 3];
+    *history = min(*history + depth * depth, HISTORY_MAX);
+}
+
+void addSearchStats(SearchStats *total, const SearchStats *stats)
+{
+    total->nodes += stats->nodes;
+    total->cutoffs += stats->cutoffs;
+    total->firstMoveCutoffs += stats->firstMoveCutoffs;
+    total->killerCutoffs += stats->killerCutoffs;
+    total->boundCutoffs += stats->boundCutoffs;
+}
+
+FORCE_INLINE int negamaxProfile(SearchBoard *searchBoard, int depth, int alpha, int beta, GameState *state, SearchContext *context, EvaluateFunction evaluate, const EvalWeights *weights, SearchFunction search, int size)
+{
+    if ((++context->stats.nodes & DEADLINE_POLL_MASK) == 0 && ((context->deadline && currentTimeMs() >= context->deadline) || (context->abort != NULL && atomic_load_explicit(context->abort, memory_order_relaxed))))
+    {
+        context->stopped = 1;
+    }
+    if (context->stopped)
+    {
+        return 0;
+    }
+
+    if (depth == 0 || context->ply >= MAX_PLY - 1 || isGameOver(searchBoard))
+    {
+        return evaluate(searchBoard, state);
+    }
+
+    uint64_t key = searchBoard->key;
+    int ttScore, ttMove = TT_NO_MOVE, ttDepth, ttBound;
+    if (probeTranspositionTable(context->table, key, &ttScore, &ttMove, &ttDepth, &ttBound) && ttDepth >= depth)
+    {
+        if (ttBound == TT_EXACT)
+        {
+            return ttScore;
+        }
+        if (ttBound == TT_LOWER)
+        {
+            alpha = max(alpha, ttScore);
+        }
+        else
+        {
+            beta = min(beta, ttScore);
+        }
+        if (beta <= alpha)
+        {
+            return ttScore;
+        }
+    }
+    if (engineConfig.scoreBounds)
+    {
+        int lower, upper;
+        scoreBounds(searchBoard, state, weights, &lower, &upper);
+        if (upper <= alpha || lower >= beta)
+        {
+            context->stats.boundCutoffs++;
+            return upper <= alpha ? upper : lower;
+        }
+    }
+    int searchAlpha = alpha;
+
+    MoveList moveList;
+    generateMovesKernel(searchBoard, &moveList, size);
+    orderMoves(searchBoard, &moveList, &state->players[state->sideToMove], ttMove, context->heuristics, context->ply);
+
+    int bestEval = -SCORE_INFINITY;
+    int bestMove = TT_NO_MOVE;
+    int futilityBase = -SCORE_INFINITY;
+    if (engineConfig.futilityPruning && depth <= FUTILITY_MAX_DEPTH)
+    {
+        futilityBase = evaluate(searchBoard, state) - searchBoard->legalJumps * weights->vulnerable + (depth - 1) * engineConfig.futilityMargin;
+    }
+
+    for (int i = 0; i < moveList.count; i++)
+    {
+        if (i > 0 && futilityBase > -SCORE_INFINITY)
+        {
+            int bound = futilityBase + chainValue(searchBoard, moveList.moves[i], &state->players[state->sideToMove], weights);
+            if (bound <= alpha)
+            {
+                bestEval = max(bestEval, bound);
+                continue;
+            }
+        }
+
+        JumpUndo undo[MAX_CHAIN];
+        applyChainKernel(searchBoard, moveList.moves[i], state, undo, size);
+
+        context->ply++;
+        int eval;
+        if (i == 0)
+        {
+            eval = -search(searchBoard, depth - 1, -beta, -alpha, state, context);
+        }
+        else
+        {
+            int reduction = engineConfig.lateMoveReductions && depth >= LATE_MOVE_MIN_DEPTH && i >= engineConfig.lateMoveIndex;
+            eval = -search(searchBoard, depth - 1 - reduction, -alpha - 1, -alpha, state, context);
+            if (reduction && eval > alpha && !context->stopped)
+            {
+                eval = -search(searchBoard, depth - 1, -alpha - 1, -alpha, state, context);
+            }
+            if (eval > alpha && eval < beta && !context->stopped)
+            {
+                eval = -search(searchBoard, depth - 1, -beta, -alpha, state, context);
+            }
+        }
+        context->ply--;
+
+        undoChainKernel(searchBoard, moveList.moves[i], state, undo, size);
+
+        if (context->stopped)
+        {
+            return 0;
+        }
+
+        if (eval > bestEval)
+        {
+            bestEval = eval;
+            bestMove = encodeMove(moveList.moves[i]);
+        }
+        alpha = max(alpha, eval);
+        if (beta <= alpha)
+        {
+            recordCutoff(context, moveList.moves[i], i, depth);
+            break;
+        }
+    }
+
+    int bound = TT_EXACT;
+    if (bestEval <= searchAlpha)
+    {
+        bound = TT_UPPER;
+    }
+    else if (bestEval >= beta)
+    {
+        bound = TT_LOWER;
+    }
+    storeTranspositionTable(context->table, key, bestEval, bestMove, depth, bound);
+
+    return bestEval;
+}
+
+#define BOARD_SIZES(X, name, profile) \
+    X(name, profile, 6, 6) X(name, profile, 7, 7) X(name, profile, 8, 8) X(name, profile, 9, 9) X(name, profile, 10, 10) \
+    X(name, profile, 11, 11) X(name, profile, 12, 12) X(name, profile, 13, 13) X(name, profile, 14, 14) X(name, profile, 15, 15) \
+    X(name, profile, 16, 16) X(name, profile, 17, 17) X(name, profile, 18, 18) X(name, profile, 19, 19) X(name, profile, 20, 20)
+
+#define DEFINE_SEARCH_KERNEL(name, profile, suffix, size) \
+    int negamax##name##suffix(SearchBoard *searchBoard, int depth, int alpha, int beta, GameState *state, SearchContext *context) \
+    { \
+        return negamaxProfile(searchBoard, depth, alpha, beta, state, context, evaluate##name, &evalProfiles[profile], negamax##name##suffix, size); \
+    }
+
+#define SEARCH_KERNEL_ENTRY(name, profile, suffix, size) [size] = negamax##name##suffix,
+
+#define DEFINE_SEARCH_PROFILE(name, profile) \
+    static inline int evaluate##name(const SearchBoard *searchBoard, const GameState *state) \
+    { \
+        return evaluatePosition(searchBoard, state, &evalProfiles[profile]); \
+    } \
+    DEFINE_SEARCH_KERNEL(name, profile, , searchBoard->size) \
+    BOARD_SIZES(DEFINE_SEARCH_KERNEL, name, profile)
+
+DEFINE_SEARCH_PROFILE(Medium, SEARCH_PROFILE_MEDIUM)
+DEFINE_SEARCH_PROFILE(Extreme, SEARCH_PROFILE_EXTREME)
+
+SearchFunction searchKernels[SEARCH_PROFILES][MAX_SIZE + 1] = {
+    {[0] = negamaxMedium, BOARD_SIZES(SEARCH_KERNEL_ENTRY, Medium, SEARCH_PROFILE_MEDIUM)},
+    {[0] = negamaxExtreme, BOARD_SIZES(SEARCH_KERNEL_ENTRY, Extreme, SEARCH_PROFILE_EXTREME)},
+};
+
+int moveTimeLimit(int gameMode)
+{
+    if (engineConfig.moveTimeMs >= 0)
+    {
+        return engineConfig.moveTimeMs;
+    }
+    return gameMode == 3 ? 0 : MOVE_TIME_MS;
+}
+
+int searchProfileId(int gameMode, int difficulty)
+{
+    return gameMode == 3 || difficulty == 2 ? SEARCH_PROFILE_EXTREME : SEARCH_PROFILE_MEDIUM;
+}
+
+void *rootSearchWorker(void *argument)
+{
+    RootSearch *root = (RootSearch *)argument;
+    SearchBoard searchBoard = *root->searchBoard;
+    GameState state = *root->state;
+    SearchContext context = {root->deadline, 0, root->abort, &root->engine->table, NULL, 1, {0, 0, 0, 0, 0}};
+    if (engineConfig.moveHeuristics)
+    {
+        context.heuristics = &root->engine->heuristics[atomic_fetch_add(&root->nextSlot, 1) % MAX_THREADS];
+    }
+    int evaluations = 0;
+
+    for (int i = atomic_fetch_add(&root->nextMove, 1); i < root->moveList->count; i = atomic_fetch_add(&root->nextMove, 1))
+    {
+        if (i > 0)
+        {
+            pthread_mutex_lock(&root->lock);
+            while (!root->firstMoveDone)
+            {
+                pthread_cond_wait(&root->firstMoveSearched, &root->lock);
+            }
+            int stopped = root->stopped;
+            pthread_mutex_unlock(&root->lock);
+            if (stopped)
+            {
+                break;
+            }
+        }
+
+        JumpUndo undo[MAX_CHAIN];
+        applyChain(&searchBoard, root->moveList->moves[i], &state, undo);
+
+        int threshold = atomic_load(&root->threshold);
+        int alpha = max(threshold, root->alpha);
+        int eval;
+        if (i == 0 || threshold == -SCORE_INFINITY)
+        {
+            eval = -root->search(&searchBoard, root->depth, -root->beta, -alpha, &state, &context);
+        }
+        else
+        {
+            eval = -root->search(&searchBoard, root->depth, -alpha - 1, -alpha, &state, &context);
+            if (eval > alpha && eval < root->beta && !context.stopped)
+            {
+                eval = -root->search(&searchBoard, root->depth, -root->beta, -alpha, &state, &context);
+            }
+        }
+
+        undoChain(&searchBoard, root->moveList->moves[i], &state, undo);
+
+        if (i == 0)
+        {
+            pthread_mutex_lock(&root->lock);
+            root->firstMoveDone = 1;
+            root->stopped |= context.stopped;
+            pthread_cond_broadcast(&root->firstMoveSearched);
+            pthread_mutex_unlock(&root->lock);
+        }
+        if (context.stopped)
+        {
+            break;
+        }
+        evaluations++;
 
-    int totalPieces = 0;
-    for (int i = 0; i < size; i++)
-    {
-        for (int j = 0; j < size; j++)
+        pthread_mutex_lock(&root->lock);
+        if (root->rankedCount < root->multiPv || eval > root->rankedScores[root->multiPv - 1])
         {
-            if (board[i][j] != ' ')
+            int slot = min(root->rankedCount, root->multiPv - 1);
+            while (slot > 0 && root->rankedScores[slot - 1] < eval)
+            {
+                root->rankedScores[slot] = root->rankedScores[slot - 1];
+                root->rankedMoves[slot] = root->rankedMoves[slot - 1];
+                slot--;
+            }
+            root->rankedScores[slot] = eval;
+            root->rankedMoves[slot] = i;
+            root->rankedCount = min(root->rankedCount + 1, root->multiPv);
+            if (root->rankedCount == root->multiPv)
             {
-                totalPieces++;
+                atomic_store(&root->threshold, root->rankedScores[root->multiPv - 1]);
             }
         }
+        pthread_mutex_unlock(&root->lock);
     }
-    int remainingPieces = totalPieces;
-    score += (totalPieces - remainingPieces) * 20;
 
-    return score;
+    pthread_mutex_lock(&root->lock);
+    root->evaluations += evaluations;
+    root->stopped |= context.stopped;
+    addSearchStats(&root->stats, &context.stats);
+    pthread_mutex_unlock(&root->lock);
+    return NULL;
 }
 
-int analysePiecesMedium(char **board, int size, Player *currentPlayer, Player *opponentPlayer)
+int aspirationBound(int eval, int window)
 {
-    int score = currentPlayer->score - opponentPlayer->score;
-
-    int setPotential = 0;
-    for (int i = 0; i < 5; i++)
+    long long bound = (long long)eval + window;
+    if (bound <= -SCORE_INFINITY || bound >= SCORE_INFINITY)
     {
-        setPotential += currentPlayer->pieces[i];
+        return bound < 0 ? -SCORE_INFINITY : SCORE_INFINITY;
     }
-    score += setPotential * 100;
+    return (int)bound;
+}
 
-    int vulnerablePieces = 0;
-    for (int srcRow = 1; srcRow <= size; srcRow++)
+int searchRootMoves(EngineContext *engine, SearchBoard *searchBoard, const GameState *state, MoveList *moveList, int depth, SearchFunction search, int alpha, int beta, int multiPv, long long deadline, atomic_int *abort, int threadCount, int firstSlot, int *rankedMoves, int *rankedScores, int *evaluations, SearchStats *stats, bool *stopped)
+{
+    RootSearch root;
+    pthread_t threads[MAX_THREADS];
+    threadCount = min(max(threadCount, 1), moveList->count);
+
+    root.engine = engine;
+    root.searchBoard = searchBoard;
+    root.state = state;
+    root.moveList = moveList;
+    root.depth = depth;
+    root.search = search;
+    root.alpha = alpha;
+    root.beta = beta;
+    root.multiPv = min(max(multiPv, 1), MAX_MULTI_PV);
+    root.deadline = deadline;
+    root.abort = abort;
+    atomic_init(&root.nextMove, 0);
+    atomic_init(&root.nextSlot, firstSlot);
+    atomic_init(&root.threshold, -SCORE_INFINITY);
+    root.rankedCount = 0;
+    root.evaluations = 0;
+    root.stopped = 0;
+    root.firstMoveDone = 0;
+    memset(&root.stats, 0, sizeof(root.stats));
+    pthread_mutex_init(&root.lock, NULL);
+    pthread_cond_init(&root.firstMoveSearched, NULL);
+
+    int started = 0;
+    for (int i = 1; i < threadCount; i++)
     {
-        for (int srcCol = 1; srcCol <= size; srcCol++)
+        if (pthread_create(&threads[started], NULL, rootSearchWorker, &root) == 0)
         {
-            if (board[srcRow - 1][srcCol - 1] != ' ')
-            {
-                for (int direction = -2; direction <= 2; direction += 4)
-                {
-                    int destRow = srcRow + direction;
-                    int destCol = srcCol;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[(srcRow + destRow) / 2 - 1][destCol - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                    destRow = srcRow;
-                    destCol = srcCol + direction;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[destRow - 1][(srcCol + destCol) / 2 - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                }
-            }
+            started++;
         }
     }
-    score -= vulnerablePieces * 1;
-
-    int opponentSetPotential = 0;
-    for (int i = 0; i < 5; i++)
+    rootSearchWorker(&root);
+    for (int i = 0; i < started; i++)
     {
-        opponentSetPotential += opponentPlayer->pieces[i];
+        pthread_join(threads[i], NULL);
     }
-    score -= opponentSetPotential * 100;
-
-    score += currentPlayer->extraPieces * 1;
-
-    return score;
+    pthread_mutex_destroy(&root.lock);
+    pthread_cond_destroy(&root.firstMoveSearched);
+
+    memcpy(rankedMoves, root.rankedMoves, root.rankedCount * sizeof(int));
+    memcpy(rankedScores, root.rankedScores, root.rankedCount * sizeof(int));
+    *evaluations += root.evaluations;
+    addSearchStats(stats, &root.stats);
+    *stopped = root.stopped;
+    return root.rankedCount;
 }
 
-int analysePiecesAi(char **board, int size, Player *currentPlayer, Player *opponentPlayer)
+void promoteRootMoves(MoveList *moveList, const int *rankedMoves, int rankedCount)
 {
-    int score = currentPlayer->score - opponentPlayer->score;
-
-    int setPotential = 0;
-    int minPieces = currentPlayer->pieces[0];
-    for (int i = 0; i < 5; i++)
+    int positions[MAX_MULTI_PV];
+    memcpy(positions, rankedMoves, rankedCount * sizeof(int));
+    for (int i = 0; i < rankedCount; i++)
     {
-        setPotential += currentPlayer->pieces[i];
-        if (currentPlayer->pieces[i] < minPieces)
+        int from = positions[i];
+        JumpMove best = moveList->moves[from];
+        moveList->moves[from] = moveList->moves[i];
+        moveList->moves[i] = best;
+        for (int j = i + 1; j < rankedCount; j++)
         {
-            minPieces = currentPlayer->pieces[i];
+            if (positions[j] == i)
+            {
+                positions[j] = from;
+            }
         }
     }
-    score += setPotential * 200;
-    score += minPieces * 400;
+}
+
+int principalVariation(EngineContext *engine, SearchBoard *searchBoard, GameState *state, JumpMove first, JumpMove *line)
+{
+    JumpUndo undo[MAX_PV_LENGTH][MAX_CHAIN];
+    int length = 0;
 
-    int vulnerablePieces = 0;
-    for (int srcRow = 1; srcRow <= size; srcRow++)
+    line[length] = first;
+    applyChain(searchBoard, first, state, undo[length++]);
+    while (length < MAX_PV_LENGTH)
     {
-        for (int srcCol = 1; srcCol <= size; srcCol++)
+        int score, move, depth, bound;
+        if (!probeTranspositionTable(&engine->table, searchBoard->key, &score, &move, &depth, &bound) || move == TT_NO_MOVE)
+        {
+            break;
+        }
+
+        MoveList moveList;
+        int found = -1;
+        int matches = 0;
+        generateMoves(searchBoard, &moveList);
+        for (int i = 0; i < moveList.count; i++)
         {
-            if (board[srcRow - 1][srcCol - 1] != ' ')
+            if (encodeMove(moveList.moves[i]) == move)
             {
-                for (int direction = -2; direction <= 2; direction += 4)
-                {
-                    int destRow = srcRow + direction;
-                    int destCol = srcCol;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[(srcRow + destRow) / 2 - 1][destCol - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                    destRow = srcRow;
-                    destCol = srcCol + direction;
-                    if (destRow >= 1 && destRow <= size && destCol >= 1 && destCol <= size)
-                    {
-                        if (board[destRow - 1][destCol - 1] == ' ' && board[destRow - 1][(srcCol + destCol) / 2 - 1] != ' ')
-                        {
-                            vulnerablePieces++;
-                        }
-                    }
-                }
+                found = i;
+                matches++;
             }
         }
+        if (matches != 1)
+        {
+            break;
+        }
+        line[length] = moveList.moves[found];
+        applyChain(searchBoard, line[length], state, undo[length]);
+        length++;
     }
-    score -= vulnerablePieces * 10;
 
-    int opponentSetPotential = 0;
-    int opponentMinPieces = opponentPlayer->pieces[0];
-    for (int i = 0; i < 5; i++)
+    for (int i = length - 1; i >= 0; i--)
     {
-        opponentSetPotential += opponentPlayer->pieces[i];
-        if (opponentPlayer->pieces[i] < opponentMinPieces)
-        {
-            opponentMinPieces = opponentPlayer->pieces[i];
-        }
+        undoChain(searchBoard, line[i], state, undo[i]);
     }
-    score -= opponentSetPotential * 200;
-    score -= opponentMinPieces * 400;
+    return length;
+}
 
-    score += currentPlayer->extraPieces * 10;
+void *lazySmpHelper(void *argument)
+{
+    LazyHelper *helper = (LazyHelper *)argument;
+    SearchBoard searchBoard = *helper->searchBoard;
+    MoveList moveList = *helper->moveList;
+    int evaluations = 0;
+    bool stopped = false;
 
-    int capturedPieces = 0;
-    for (int i = 0; i < 5; i++)
+    for (int i = 0; i < helper->index % moveList.count; i++)
     {
-        capturedPieces += currentPlayer->pieces[i] - opponentPlayer->pieces[i];
+        JumpMove first = moveList.moves[0];
+        memmove(moveList.moves, moveList.moves + 1, (moveList.count - 1) * sizeof(JumpMove));
+        moveList.moves[moveList.count - 1] = first;
     }
-    score += capturedPieces * 100;
 
-    int totalPieces = 0;
-    for (int i = 0; i < size; i++)
+    for (int iterationDepth = helper->index & 1; iterationDepth <= helper->depth + 1 && !stopped; iterationDepth++)
     {
-        for (int j = 0; j < size; j++)
+        int iterationBest, iterationEval;
+        if (searchRootMoves(helper->engine, &searchBoard, helper->state, &moveList, iterationDepth, helper->search, -SCORE_INFINITY, SCORE_INFINITY, 1, helper->deadline, helper->abort, 1, helper->index, &iterationBest, &iterationEval, &evaluations, &helper->stats, &stopped) > 0)
         {
-            if (board[i][j] != ' ')
-            {
-                totalPieces++;
-            }
+            promoteRootMoves(&moveList, &iterationBest, 1);
         }
     }
-    int remainingPieces = totalPieces;
-    score += (totalPieces - remainingPieces) * 20;
-
-    return score;
+    return NULL;
 }
 
-int isValidMove(char **board, int size, int srcRow, int srcCol, int destRow, int destCol, int currentPlayer)
+int analysePosition(EngineContext *engine, Board *board, int size, Player *player, Player *opponent, int depth, int profile, int multiPv, int moveTimeMs, AnalysisLine *lines, int *evaluations)
 {
-    if (srcRow < 1 || srcRow > size || srcCol < 1 || srcCol > size ||
-        destRow < 1 || destRow > size || destCol < 1 || destCol > size)
+    int iterationScores[MAX_PLY];
+    int rankedMoves[MAX_MULTI_PV];
+    int rankedScores[MAX_MULTI_PV];
+    int lineCount = 0;
+    multiPv = min(max(multiPv, 1), MAX_MULTI_PV);
+
+    if (engine->table.buckets == NULL)
     {
-        return 0;
+        resetEngineContext();
     }
+    memset(&lastSearchStats, 0, sizeof(lastSearchStats));
+
+    SearchFunction search = searchKernels[profile][engineConfig.sizeKernels ? size : 0];
 
-    if (board[srcRow - 1][srcCol - 1] == ' ')
+    GameState state = {{*player, *opponent}, 0};
+    SearchBoard searchBoard;
+    initSearchBoard(&searchBoard, board, size);
+    searchBoard.key ^= playerKey(&state.players[0], 0) ^ playerKey(&state.players[1], 1) ^ zobristPreset[profile];
+
+    int expectedMove = predictedMove(engine, searchBoard.key);
+    advanceTranspositionTable(&engine->table);
+    ageSearchHeuristics(engine, expectedMove != TT_NO_MOVE ? 2 : MAX_PLY);
+    if (expectedMove != TT_NO_MOVE)
     {
-        return 0;
+        engine->predictedHits++;
     }
 
-    if (board[destRow - 1][destCol - 1] != ' ')
+    long long deadline = 0;
+    if (moveTimeMs > 0)
     {
-        return 0;
+        deadline = currentTimeMs() + moveTimeMs;
     }
 
-    int deltaRow = abs(destRow - srcRow);
-    int deltaCol = abs(destCol - srcCol);
+    MoveList moveList;
+    generateMoves(&searchBoard, &moveList);
+    orderMoves(&searchBoard, &moveList, &state.players[0], expectedMove, NULL, 0);
 
-    if ((deltaRow == 2 && deltaCol == 0) || (deltaRow == 0 && deltaCol == 2))
-    {
-        int midRow = (srcRow + destRow) / 2;
-        int midCol = (srcCol + destCol) / 2;
+    int rootThreads = engineConfig.threads;
+    int helperCount = 0;
+    LazyHelper helpers[MAX_THREADS];
+    pthread_t helperThreads[MAX_THREADS];
+    MoveList helperMoves = moveList;
+    atomic_int abortHelpers;
+    atomic_init(&abortHelpers, 0);
 
-        if (board[midRow - 1][midCol - 1] != ' ')
+    if (engineConfig.lazySmp && moveList.count > 0)
+    {
+        rootThreads = 1;
+        for (int i = 1; i < engineConfig.threads; i++)
         {
-            return 1;
+            LazyHelper helper = {engine, &searchBoard, &state, &helperMoves, i, depth, search, deadline, &abortHelpers, {0, 0, 0, 0, 0}};
+            helpers[helperCount] = helper;
+            if (pthread_create(&helperThreads[helperCount], NULL, lazySmpHelper, &helpers[helperCount]) == 0)
+            {
+                helperCount++;
+            }
         }
     }
 
-    return 0;
-}
-
-int isGameOver(char **board, int size, Player *currentPlayer, Player *opponentPlayer)
-{
-    for (int srcRow = 1; srcRow <= size; srcRow++)
+    bool stopped = false;
+    for (int iterationDepth = 0; iterationDepth <= depth && !stopped; iterationDepth++)
     {
-        for (int srcCol = 1; srcCol <= size; srcCol++)
+        int rankedCount;
+        int window = engineConfig.aspirationWindow;
+        int alpha = -SCORE_INFINITY;
+        int beta = SCORE_INFINITY;
+        if (lineCount > 0 && multiPv == 1 && iterationDepth >= 2 && window > 0)
         {
-            if (board[srcRow - 1][srcCol - 1] != ' ' && (board[srcRow - 1][srcCol - 1] == 'A' || board[srcRow - 1][srcCol - 1] == 'B' ||
-                                                         board[srcRow - 1][srcCol - 1] == 'C' || board[srcRow - 1][srcCol - 1] == 'D' || board[srcRow - 1][srcCol - 1] == 'E'))
+            alpha = aspirationBound(iterationScores[iterationDepth - 2], -window);
+            beta = aspirationBound(iterationScores[iterationDepth - 2], window);
+        }
+
+        while (true)
+        {
+            rankedCount = searchRootMoves(engine, &searchBoard, &state, &moveList, iterationDepth, search, alpha, beta, multiPv, deadline, NULL, rootThreads, 0, rankedMoves, rankedScores, evaluations, &lastSearchStats, &stopped);
+            if (stopped || rankedCount == 0 || (rankedScores[0] > alpha && rankedScores[0] < beta))
             {
-                for (int destRow = 1; destRow <= size; destRow++)
-                {
-                    for (int destCol = 1; destCol <= size; destCol++)
-                    {
-                        if (isValidMove(board, size, srcRow, srcCol, destRow, destCol, 1))
-                        {
-                            return 0;
-                        }
-                    }
-                }
+                break;
+            }
+            window = window > SCORE_INFINITY / 4 ? SCORE_INFINITY : window * 4;
+            if (rankedScores[0] <= alpha)
+            {
+                alpha = aspirationBound(rankedScores[0], -window);
+            }
+            else
+            {
+                beta = aspirationBound(rankedScores[0], window);
             }
         }
-    }
-    return 1;
-}
 
-int checkGameOver(char **board, int size, Player *player1, Player *player2)
-{
-    return isGameOver(board, size, player1, player2) && isGameOver(board, size, player2, player1);
-}
+        while (stopped && rankedCount > 0 && rankedScores[rankedCount - 1] <= alpha)
+        {
+            rankedCount--;
+        }
+        if (rankedCount > 0)
+        {
+            promoteRootMoves(&moveList, rankedMoves, rankedCount);
+            for (int i = 0; i < rankedCount; i++)
+            {
+                lines[i].score = rankedScores[i];
+            }
+            lineCount = rankedCount;
+            iterationScores[iterationDepth] = rankedScores[0];
+        }
+    }
 
-void chooseAnalysePreset(int gameMode, int difficulty, int (**analysePiecesPtr)(char **, int, Player *, Player *))
-{
-    if (gameMode == 3)
+    atomic_store(&abortHelpers, 1);
+    for (int i = 0; i < helperCount; i++)
     {
-
-        *analysePiecesPtr = analysePiecesAi;
+        pthread_join(helperThreads[i], NULL);
+        addSearchStats(&lastSearchStats, &helpers[i].stats);
     }
-    else if (difficulty == 2)
-    {
 
-        *analysePiecesPtr = analysePieces;
+    for (int i = 0; i < lineCount; i++)
+    {
+        lines[i].length = principalVariation(engine, &searchBoard, &state, moveList.moves[i], lines[i].moves);
     }
-    else
+    if (lineCount > 0 && lines[0].length >= 3)
     {
-
-        *analysePiecesPtr = analysePiecesMedium;
+        JumpUndo undo[2][MAX_CHAIN];
+        applyChain(&searchBoard, lines[0].moves[0], &state, undo[0]);
+        applyChain(&searchBoard, lines[0].moves[1], &state, undo[1]);
+        PredictedPosition *prediction = &engine->predictions[engine->nextPrediction++ % ENGINE_PREDICTIONS];
+        prediction->key = searchBoard.key;
+        prediction->move = encodeMove(lines[0].moves[2]);
+        undoChain(&searchBoard, lines[0].moves[1], &state, undo[1]);
+        undoChain(&searchBoard, lines[0].moves[0], &state, undo[0]);
     }
+    return lineCount;
 }
 
-int alphaBeta(char **board, int size, int depth, int alpha, int beta, int maximizingPlayer, Player *currentPlayer, Player *opponentPlayer, int difficulty, int gameMode)
+void printChain(JumpMove move, int size)
 {
-
-    static int totalEvaluations = 0;
-    totalEvaluations++;
-    int (*analysePiecesPtr)(char **, int, Player *, Player *);
-    bool exitPruningLoop;
-
-    chooseAnalysePreset(gameMode, difficulty, &analysePiecesPtr);
-
-    if (depth == 0 || (isGameOver(board, size, currentPlayer, opponentPlayer) && isGameOver(board, size, opponentPlayer, currentPlayer)))
+    int cell = move.src;
+    printf("%d %d", cell / size + 1, cell % size + 1);
+    for (int i = 0; i < move.length; i++)
     {
-        return analysePiecesPtr(board, size, currentPlayer, opponentPlayer);
+        cell = jumpEdges[size][cell][(move.path >> (2 * i)) & 3].dest;
+        printf(" -> %d %d", cell / size + 1, cell % size + 1);
     }
+}
 
-    if (maximizingPlayer)
-    {
-        int maxEval = INT_MIN;
-        bool exitPruningLoop = false;
-
-        for (int srcRow = 1; srcRow <= size && !exitPruningLoop; srcRow++)
-        {
-            for (int srcCol = 1; srcCol <= size && !exitPruningLoop; srcCol++)
-            {
-                if (board[srcRow - 1][srcCol - 1] != ' ')
-                {
-                    for (int destRow = 1; destRow <= size && !exitPruningLoop; destRow++)
-                    {
-                        for (int destCol = 1; destCol <= size && !exitPruningLoop; destCol++)
-                        {
-                            if (isValidMove(board, size, srcRow, srcCol, destRow, destCol, 2))
-                            {
-
-                                int midRow = (srcRow + destRow) / 2;
-                                int midCol = (srcCol + destCol) / 2;
-                                char capturedPiece = board[midRow - 1][midCol - 1];
-                                board[destRow - 1][destCol - 1] = board[srcRow - 1][srcCol - 1];
-                                board[srcRow - 1][srcCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = ' ';
-                                currentPlayer->pieces[capturedPiece - 'A']++;
-                                calculateScore(currentPlayer);
-
-                                int eval = alphaBeta(board, size, depth - 1, alpha, beta, 0, currentPlayer, opponentPlayer, difficulty, gameMode);
-
-                                board[srcRow - 1][srcCol - 1] = board[destRow - 1][destCol - 1];
-                                board[destRow - 1][destCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = capturedPiece;
-                                currentPlayer->pieces[capturedPiece - 'A']--;
-                                calculateScore(currentPlayer);
-
-                                maxEval = max(maxEval, eval);
-                                alpha = max(alpha, eval);
-                                if (beta <= alpha)
-                                {
-                                    exitPruningLoop = true;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return maxEval;
-    }
-    else
+void printAnalysis(const AnalysisLine *lines, int lineCount, int size)
+{
+    for (int i = 0; i < lineCount; i++)
     {
-        int minEval = INT_MAX;
-        bool exitPruningLoop = false;
-
-        for (int srcRow = 1; srcRow <= size && !exitPruningLoop; srcRow++)
+        printf("%d. (%+d) ", i + 1, lines[i].score);
+        for (int j = 0; j < lines[i].length; j++)
         {
-            for (int srcCol = 1; srcCol <= size && !exitPruningLoop; srcCol++)
+            if (j > 0)
             {
-                if (board[srcRow - 1][srcCol - 1] != ' ')
-                {
-                    for (int destRow = 1; destRow <= size && !exitPruningLoop; destRow++)
-                    {
-                        for (int destCol = 1; destCol <= size && !exitPruningLoop; destCol++)
-                        {
-                            if (isValidMove(board, size, srcRow, srcCol, destRow, destCol, 1))
-                            {
-
-                                int midRow = (srcRow + destRow) / 2;
-                                int midCol = (srcCol + destCol) / 2;
-                                char capturedPiece = board[midRow - 1][midCol - 1];
-                                board[destRow - 1][destCol - 1] = board[srcRow - 1][srcCol - 1];
-                                board[srcRow - 1][srcCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = ' ';
-                                currentPlayer->pieces[capturedPiece - 'A']++;
-                                calculateScore(currentPlayer);
-
-                                int eval = alphaBeta(board, size, depth - 1, alpha, beta, 1, currentPlayer, opponentPlayer, difficulty, gameMode);
-
-                                board[srcRow - 1][srcCol - 1] = board[destRow - 1][destCol - 1];
-                                board[destRow - 1][destCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = capturedPiece;
-                                currentPlayer->pieces[capturedPiece - 'A']--;
-                                calculateScore(currentPlayer);
-
-                                minEval = min(minEval, eval);
-                                beta = min(beta, eval);
-                                if (beta <= alpha)
-                                {
-                                    exitPruningLoop = true;
-                                }
-                            }
-                        }
-                    }
-                }
+                printf(", ");
             }
+            printChain(lines[i].moves[j], size);
         }
-        return minEval;
+        printf("\n");
     }
 }
 
-void makeComputerMove(char **board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack, MoveStack *redoStack, int difficulty, int gameMode, int writeToFileMode, int *totalEvaluations, int controlMode, int selectedRow, int selectedCol, int highlight)
+void makeComputerMove(EngineContext *engine, Board *board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack, MoveStack *redoStack, int difficulty, int gameMode, int writeToFileMode, int *totalEvaluations, int controlMode, int selectedRow, int selectedCol, int highlight)
 {
     Player *currentPlayerPtr = player2;
     Player *opponentPlayerPtr = player1;
-    int bestSrcRow, bestSrcCol, bestDestRow, bestDestCol;
-    int maxEval;
     int localEvaluations = 0;
     int depth;
-    bool validMove;
-    bool validExtraMove;
 
     if (difficulty == 2)
     {
@@ -857,114 +2626,242 @@ void makeComputerMove(char **board, int size, int *currentPlayer, Player *player
         depth = 1;
     }
 
-    validMove = true;
-    while (validMove)
+    lastAnalysisCount = analysePosition(engine, board, size, currentPlayerPtr, opponentPlayerPtr, depth, searchProfileId(gameMode, difficulty), engineConfig.multiPv, moveTimeLimit(gameMode), lastAnalysis, &localEvaluations);
+
+    if (lastAnalysisCount > 0)
     {
-        bestSrcRow = bestSrcCol = bestDestRow = bestDestCol = -1;
-        maxEval = INT_MIN;
+        JumpMove best = lastAnalysis[0].moves[0];
+        int cell = best.src;
+        for (int i = 0; i < best.length; i++)
+        {
+            int next = jumpEdges[size][cell][(best.path >> (2 * i)) & 3].dest;
+            Move move = {cell / size, cell % size, next / size, next % size, {' ', 0, 0}};
+            playMove(board, currentPlayerPtr, &move);
+            pushMove(undoStack, move);
+            cell = next;
+        }
+
+        redoStack->top = -1;
+    }
 
-        for (int srcRow = 1; srcRow <= size; srcRow++)
+    *totalEvaluations += localEvaluations;
+
+    if (!writeToFileMode)
+    {
+        clearScreen();
+        printf("\nBilgisayar hamle yapti.\n\nGuncel oyun tahtasi:\n\n");
+        printBoard(board, size, player1, player2, gameMode, controlMode, selectedRow, selectedCol, highlight);
+        printf("\n");
+        if (engineConfig.multiPv > 1)
         {
-            for (int srcCol = 1; srcCol <= size; srcCol++)
-            {
-                if (board[srcRow - 1][srcCol - 1] != ' ')
-                {
-                    for (int destRow = 1; destRow <= size; destRow++)
-                    {
-                        for (int destCol = 1; destCol <= size; destCol++)
-                        {
-                            if (isValidMove(board, size, srcRow, srcCol, destRow, destCol, 2))
-                            {
+            printf("Bilgisayarin degerlendirdigi hamleler (puan, ardindan beklenen oyun akisi):\n");
+            printAnalysis(lastAnalysis, lastAnalysisCount, size);
+            printf("\n");
+        }
+    }
+}
 
-                                int midRow = (srcRow + destRow) / 2;
-                                int midCol = (srcCol + destCol) / 2;
-                                char capturedPiece = board[midRow - 1][midCol - 1];
-                                board[destRow - 1][destCol - 1] = board[srcRow - 1][srcCol - 1];
-                                board[srcRow - 1][srcCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = ' ';
-                                currentPlayerPtr->pieces[capturedPiece - 'A']++;
-                                currentPlayerPtr->extraPieces++;
-                                calculateScore(currentPlayerPtr);
-
-                                int eval = alphaBeta(board, size, depth, INT_MIN, INT_MAX, 0, currentPlayerPtr, opponentPlayerPtr, difficulty, gameMode);
-                                localEvaluations++;
-
-                                board[srcRow - 1][srcCol - 1] = board[destRow - 1][destCol - 1];
-                                board[destRow - 1][destCol - 1] = ' ';
-                                board[midRow - 1][midCol - 1] = capturedPiece;
-                                currentPlayerPtr->pieces[capturedPiece - 'A']--;
-                                currentPlayerPtr->extraPieces--;
-                                calculateScore(currentPlayerPtr);
-
-                                if (eval > maxEval)
-                                {
-                                    bestSrcRow = srcRow;
-                                    bestSrcCol = srcCol;
-                                    bestDestRow = destRow;
-                                    bestDestCol = destCol;
-                                    maxEval = eval;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+long long benchmarkPositions(Board **positions, int *sizes, int positionCount, SearchStats *stats)
+{
+    long long elapsed = 0;
+    memset(stats, 0, sizeof(*stats));
+
+    for (int i = 0; i < positionCount; i++)
+    {
+        int size = sizes[i];
+        int currentPlayer = 2;
+        int evaluations = 0;
+        Board *board = createBoard(size);
+        Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
+        Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
+        MoveStack undoStack, redoStack;
+
+        *board = *positions[i];
+        initMoveStack(&undoStack, size * size);
+        initMoveStack(&redoStack, size * size);
+        resetEngineContext();
+
+        long long start = currentTimeMs();
+        makeComputerMove(&engineContext, board, size, &currentPlayer, &player1, &player2, &undoStack, &redoStack, 2, 2, 1, &evaluations, 0, 0, 0, 0);
+        elapsed += currentTimeMs() - start;
+        addSearchStats(stats, &lastSearchStats);
+
+        freeMoveStack(&undoStack);
+        freeMoveStack(&redoStack);
+        freeBoard(board);
+    }
+    return elapsed;
+}
+
+long long benchmarkGame(Board *position, int size, int moves, int keepContext, SearchStats *stats, long long *predictedHits)
+{
+    long long elapsed = 0;
+    int currentPlayer = 2;
+    int evaluations = 0;
+    Board *board = createBoard(size);
+    Player players[2] = {{0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5}, {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5}};
+    MoveStack undoStack, redoStack;
+
+    *board = *position;
+    initMoveStack(&undoStack, size * size);
+    initMoveStack(&redoStack, size * size);
+    memset(stats, 0, sizeof(*stats));
+    resetEngineContext();
+
+    for (int move = 0; move < moves && !checkGameOver(board, size); move++)
+    {
+        if (!keepContext)
+        {
+            resetEngineContext();
         }
+        long long start = currentTimeMs();
+        makeComputerMove((move & 1) ? &secondEngineContext : &engineContext, board, size, &currentPlayer, &players[move & 1], &players[!(move & 1)], &undoStack, &redoStack, 2, 2, 1, &evaluations, 0, 0, 0, 0);
+        elapsed += currentTimeMs() - start;
+        addSearchStats(stats, &lastSearchStats);
+    }
+    *predictedHits = engineContext.predictedHits + secondEngineContext.predictedHits;
+
+    freeMoveStack(&undoStack);
+    freeMoveStack(&redoStack);
+    freeBoard(board);
+    return elapsed;
+}
 
-        validExtraMove = true;
-        while (validExtraMove)
+void benchmarkSearch()
+{
+    int sizes[] = {12, 16, 20};
+    int positionCount = sizeof(sizes) / sizeof(sizes[0]);
+    Board *positions[sizeof(sizes) / sizeof(sizes[0])];
+    int maxThreads = min(max(onlineProcessors(), engineConfig.threads), MAX_THREADS);
+    EngineConfig savedConfig = engineConfig;
+    long long baseTime[2] = {1, 1};
+    SearchStats stats;
+
+    for (int i = 0; i < positionCount; i++)
+    {
+        positions[i] = createBoard(sizes[i]);
+        fillBoard(positions[i], sizes[i]);
+        for (int j = 0; j < sizes[i] * sizes[i] / 10; j++)
         {
-            if (bestSrcRow != -1 && bestSrcCol != -1 && bestDestRow != -1 && bestDestCol != -1)
-            {
-                int midRow = (bestSrcRow + bestDestRow) / 2;
-                int midCol = (bestSrcCol + bestDestCol) / 2;
-                char capturedPiece = board[midRow - 1][midCol - 1];
-                board[bestDestRow - 1][bestDestCol - 1] = board[bestSrcRow - 1][bestSrcCol - 1];
-                board[bestSrcRow - 1][bestSrcCol - 1] = ' ';
-                board[midRow - 1][midCol - 1] = ' ';
-                currentPlayerPtr->pieces[capturedPiece - 'A']++;
-                currentPlayerPtr->extraPieces++;
-                calculateScore(currentPlayerPtr);
+            int row = rand() % sizes[i];
+            setCell(positions[i], row, rand() % sizes[i], ' ');
+        }
+    }
+    if (engineContext.table.buckets == NULL)
+    {
+        resetEngineContext();
+    }
+    engineConfig.moveTimeMs = 0;
 
-                Move move = {bestSrcRow - 1, bestSrcCol - 1, bestDestRow - 1, bestDestCol - 1, capturedPiece};
-                pushMove(undoStack, move);
+    printf("\nOrta oyundan %d pozisyon (12, 16 ve 20 boyutlarinda) Extreme derinliginde en fazla %d thread ile araniyor...\n", positionCount, maxThreads);
+    printf("Vektor cekirdekleri: %s\n\n", simdLevelName(activeSimdLevel));
+    printf(" Thread   Kok bolme (ms)    Hizlanma  Lazy SMP (ms)   Hizlanma\n");
 
-                redoStack->top = -1;
+    for (int threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2)
+    {
+        long long elapsed[2] = {0, 0};
+        engineConfig.threads = threads;
 
-                int extraSrcRow = bestDestRow;
-                int extraSrcCol = bestDestCol;
-                int extraDestRow = extraSrcRow + (bestDestRow - bestSrcRow);
-                int extraDestCol = extraSrcCol + (bestDestCol - bestSrcCol);
-                if (isValidMove(board, size, extraSrcRow, extraSrcCol, extraDestRow, extraDestCol, 2))
-                {
-                    bestSrcRow = extraSrcRow;
-                    bestSrcCol = extraSrcCol;
-                    validExtraMove = true;
-                }
-                else
-                {
-                    validExtraMove = false;
-                }
+        for (int mode = 0; mode < 2; mode++)
+        {
+            engineConfig.lazySmp = mode;
+            elapsed[mode] = benchmarkPositions(positions, sizes, positionCount, &stats);
+            if (threads == 1)
+            {
+                baseTime[mode] = max(elapsed[mode], 1);
             }
         }
 
-        validMove = false;
+        printf("%7d   %15lld   %6.2fx   %13lld   %6.2fx\n", threads, elapsed[0], (double)baseTime[0] / max(elapsed[0], 1), elapsed[1], (double)baseTime[1] / max(elapsed[1], 1));
     }
 
-    *totalEvaluations += localEvaluations;
+    printf("\nKiller/gecmis     Sure (ms)      Dugumler   Kesmeler   Ilk hamle kesmesi   Killer kesmesi\n");
+    engineConfig.threads = 1;
+    engineConfig.lazySmp = 0;
+    for (int heuristics = 1; heuristics >= 0; heuristics--)
+    {
+        engineConfig.moveHeuristics = heuristics;
+        long long elapsed = benchmarkPositions(positions, sizes, positionCount, &stats);
+        printf("%15s   %9lld   %9lld   %8lld   %16.1f%%   %14lld\n", heuristics ? "acik" : "kapali", elapsed, stats.nodes, stats.cutoffs, 100.0 * stats.firstMoveCutoffs / max(stats.cutoffs, 1), stats.killerCutoffs);
+    }
 
-    if (!writeToFileMode)
+    printf("\nGec hamle indirimi     Bosuna budama      Sure (ms)    Dugumler\n");
+    engineConfig.moveHeuristics = savedConfig.moveHeuristics;
+    for (int selective = 0; selective < 4; selective++)
     {
-        clearScreen();
-        printf("\nBilgisayar hamle yapti.\n\nGuncel oyun tahtasi:\n\n");
-        printBoard(board, size, player1, player2, gameMode, controlMode, selectedRow, selectedCol, highlight);
-        printf("\n");
+        engineConfig.lateMoveReductions = selective & 1;
+        engineConfig.futilityPruning = selective >> 1;
+        long long elapsed = benchmarkPositions(positions, sizes, positionCount, &stats);
+        printf("%18s   %15s   %9lld   %9lld\n", engineConfig.lateMoveReductions ? "acik" : "kapali", engineConfig.futilityPruning ? "acik" : "kapali", elapsed, stats.nodes);
+    }
+
+    printf("\nSkor sinirlari   Konum          Sure (ms)    Dugumler   Sinir kesmeleri\n");
+    engineConfig.lateMoveReductions = savedConfig.lateMoveReductions;
+    engineConfig.futilityPruning = savedConfig.futilityPruning;
+    Board *endgames[sizeof(sizes) / sizeof(sizes[0])];
+    for (int i = 0; i < positionCount; i++)
+    {
+        endgames[i] = createBoard(sizes[i]);
+        fillBoard(endgames[i], sizes[i]);
+        for (int j = 0; j < sizes[i] * sizes[i]; j++)
+        {
+            int row = rand() % sizes[i];
+            setCell(endgames[i], row, rand() % sizes[i], ' ');
+        }
+    }
+    for (int bounds = 1; bounds >= 0; bounds--)
+    {
+        engineConfig.scoreBounds = bounds;
+        for (int endgame = 0; endgame < 2; endgame++)
+        {
+            long long elapsed = benchmarkPositions(endgame ? endgames : positions, sizes, positionCount, &stats);
+            printf("%14s   %11s   %9lld   %10lld   %15lld\n", bounds ? "acik" : "kapali", endgame ? "oyun sonu" : "oyun ortasi", elapsed, stats.nodes, stats.boundCutoffs);
+        }
+    }
+    for (int i = 0; i < positionCount; i++)
+    {
+        freeBoard(endgames[i]);
+    }
+
+    printf("\nMotor baglami    Sure (ms)    Dugumler   Beklenen yanitlar\n");
+    engineConfig.scoreBounds = savedConfig.scoreBounds;
+    for (int keepContext = 1; keepContext >= 0; keepContext--)
+    {
+        long long predictedHits = 0;
+        long long elapsed = benchmarkGame(positions[0], sizes[0], 10, keepContext, &stats, &predictedHits);
+        printf("%14s   %9lld   %9lld   %17lld\n", keepContext ? "korundu" : "sifirlandi", elapsed, stats.nodes, predictedHits);
+    }
+
+    printf("\nBoyut  Genel cekirdek (kdugum/sn)  Boyut cekirdegi (kdugum/sn)  Hizlanma\n");
+    for (int size = MIN_SIZE; size <= MAX_SIZE; size += 2)
+    {
+        Board *position = createBoard(size);
+        double rate[2];
+
+        fillBoard(position, size);
+        for (int j = 0; j < size * size / 10; j++)
+        {
+            int row = rand() % size;
+            setCell(position, row, rand() % size, ' ');
+        }
+        for (int kernels = 0; kernels < 2; kernels++)
+        {
+            engineConfig.sizeKernels = kernels;
+            long long elapsed = benchmarkPositions(&position, &size, 1, &stats);
+            rate[kernels] = (double)stats.nodes / max(elapsed, 1);
+        }
+        printf("%4d   %25.1f   %22.1f   %6.2fx\n", size, rate[0], rate[1], rate[1] / (rate[0] > 0 ? rate[0] : 1));
+        freeBoard(position);
     }
 
-    checkGameOver(board, size, player1, player2);
+    engineConfig = savedConfig;
+    for (int i = 0; i < positionCount; i++)
+    {
+        freeBoard(positions[i]);
+    }
 }
 
-void saveGame(char **board, int size, Player player1, Player player2, int currentPlayer)
+void saveGame(Board *board, int size, Player player1, Player player2, int currentPlayer)
 {
     char input[100];
     char filename[105];
@@ -1001,7 +2898,8 @@ void saveGame(char **board, int size, Player player1, Player player2, int curren
     {
         for (int j = 0; j < size; j++)
         {
-            fprintf(file, "%c ", board[i][j] == ' ' ? '*' : board[i][j]);
+            char piece = getCell(board, i, j);
+            fprintf(file, "%c ", piece == ' ' ? '*' : piece);
         }
         fprintf(file, "\n");
     }
@@ -1016,7 +2914,7 @@ void saveGame(char **board, int size, Player player1, Player player2, int curren
     printf("\nOyun basariyla %s dosyasina kaydedildi.\n\n", filename);
 }
 
-void loadGame(char ***board, int *size, Player *player1, Player *player2, int *currentPlayer)
+void loadGame(Board **board, int *size, Player *player1, Player *player2, int *currentPlayer)
 {
     char input[100];
     char filename[105];
@@ -1052,15 +2950,18 @@ void loadGame(char ***board, int *size, Player *player1, Player *player2, int *c
         }
     }
 
-    fscanf(file, "%d", size);
+    int savedSize;
+    if (fscanf(file, "%d", &savedSize) != 1 || savedSize < MIN_SIZE || savedSize > MAX_SIZE)
+    {
+        fclose(file);
+        printf("\nKayit dosyasi gecersiz veya bozuk.\n\n");
+        return;
+    }
+    *size = savedSize;
 
     if (*board != NULL)
     {
-        for (int i = 0; i < *size; i++)
-        {
-            free((*board)[i]);
-        }
-        free(*board);
+        freeBoard(*board);
     }
 
     *board = createBoard(*size);
@@ -1071,7 +2972,7 @@ void loadGame(char ***board, int *size, Player *player1, Player *player2, int *c
         {
             char temp;
             fscanf(file, " %c", &temp);
-            (*board)[i][j] = (temp == '*') ? ' ' : temp;
+            setCell(*board, i, j, (temp == '*') ? ' ' : temp);
         }
     }
 
@@ -1082,6 +2983,9 @@ void loadGame(char ***board, int *size, Player *player1, Player *player2, int *c
     fscanf(file, "%d", currentPlayer);
 
     fclose(file);
+    calculateScore(player1);
+    calculateScore(player2);
+    resetEngineContext();
 
     clearScreen();
     printf("\nYuklenen Oyun Tahtasi:\n\n");
@@ -1125,7 +3029,7 @@ char getChar()
 #endif
 }
 
-void selectSourceWithWASD(char **board, int size, int *srcRow, int *srcCol, int *destRow, int *destCol, Player *player1, Player *player2, int gameMode, int *currentPlayer, int *extraMove, MoveStack *undoStack, MoveStack *redoStack, int *gameLoaded, int controlMode)
+void selectSourceWithWASD(Board *board, int size, int *srcRow, int *srcCol, int *destRow, int *destCol, Player *player1, Player *player2, int gameMode, int *currentPlayer, int *extraMove, MoveStack *undoStack, MoveStack *redoStack, int *gameLoaded, int controlMode)
 {
     int row = 0, col = 0;
     if (*extraMove)
@@ -1182,14 +3086,11 @@ void selectSourceWithWASD(char **board, int size, int *srcRow, int *srcCol, int
                 break;
             case '\r':
 
-                if (board[row][col] == '*')
+                if (getCell(board, row, col) == '*')
                 {
                     printf("\nBos hucre secilemez. Lutfen gecerli bir tas seciniz.\n\n");
                 }
-                else if ((row > 1 && board[row - 1][col] != ' ' && board[row - 2][col] == ' ') ||
-                         (col > 1 && board[row][col - 1] != ' ' && board[row][col - 2] == ' ') ||
-                         (row < size - 2 && board[row + 1][col] != ' ' && board[row + 2][col] == ' ') ||
-                         (col < size - 2 && board[row][col + 1] != ' ' && board[row][col + 2] == ' '))
+                else if (canJumpFrom(board, row, col))
                 {
 
                     *srcRow = row + 1;
@@ -1257,20 +3158,20 @@ void selectSourceWithWASD(char **board, int size, int *srcRow, int *srcCol, int
             }
         }
 
-        if (board[newRow][newCol] == ' ')
+        if (getCell(board, newRow, newCol) == ' ')
         {
-            if (board[row][col] == '*')
+            if (getCell(board, row, col) == '*')
             {
-                board[row][col] = tempChar;
+                setCell(board, row, col, tempChar);
             }
-            tempChar = board[newRow][newCol];
-            board[newRow][newCol] = '*';
+            tempChar = getCell(board, newRow, newCol);
+            setCell(board, newRow, newCol, '*');
         }
         else
         {
-            if (board[row][col] == '*')
+            if (getCell(board, row, col) == '*')
             {
-                board[row][col] = ' ';
+                setCell(board, row, col, ' ');
             }
         }
 
@@ -1279,20 +3180,14 @@ void selectSourceWithWASD(char **board, int size, int *srcRow, int *srcCol, int
     }
 }
 
-void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, int *destRow, int *destCol, Player *player1, Player *player2, int gameMode, int *currentPlayer, int *extraMove, int controlMode)
+void selectDestinationWithWASD(Board *board, int size, int srcRow, int srcCol, int *destRow, int *destCol, Player *player1, Player *player2, int gameMode, int *currentPlayer, int *extraMove, int controlMode)
 {
     int row = srcRow - 1, col = srcCol - 1;
-    int tempChar = board[row][col];
+    int tempChar = getCell(board, row, col);
     char input[100];
 
-    char **tempBoard = createBoard(size);
-    for (int i = 0; i < size; i++)
-    {
-        for (int j = 0; j < size; j++)
-        {
-            tempBoard[i][j] = board[i][j];
-        }
-    }
+    Board *tempBoard = createBoard(size);
+    *tempBoard = *board;
 
     printBoard(board, size, player1, player2, gameMode, controlMode, row, col, 1);
     printf("Oyuncu %d hamlesi\n", *currentPlayer);
@@ -1311,7 +3206,7 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
             switch (ch)
             {
             case 'w':
-                if (row > 1 && tempBoard[row - 1][col] != ' ' && tempBoard[row - 2][col] == ' ')
+                if (canJumpToward(tempBoard, row, col, -BOARD_STRIDE))
                 {
                     newRow -= 2;
                     clearScreen();
@@ -1326,7 +3221,7 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
                 validInput = 1;
                 break;
             case 'a':
-                if (col > 1 && tempBoard[row][col - 1] != ' ' && tempBoard[row][col - 2] == ' ')
+                if (canJumpToward(tempBoard, row, col, -1))
                 {
                     newCol -= 2;
                     clearScreen();
@@ -1341,7 +3236,7 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
                 validInput = 1;
                 break;
             case 's':
-                if (row < size - 2 && tempBoard[row + 1][col] != ' ' && tempBoard[row + 2][col] == ' ')
+                if (canJumpToward(tempBoard, row, col, BOARD_STRIDE))
                 {
                     newRow += 2;
                     clearScreen();
@@ -1356,7 +3251,7 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
                 validInput = 1;
                 break;
             case 'd':
-                if (col < size - 2 && tempBoard[row][col + 1] != ' ' && tempBoard[row][col + 2] == ' ')
+                if (canJumpToward(tempBoard, row, col, 1))
                 {
                     newCol += 2;
                     clearScreen();
@@ -1421,8 +3316,8 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
 
         if (!validMove)
         {
-            tempBoard[row][col] = ' ';
-            tempBoard[newRow][newCol] = tempChar;
+            setCell(tempBoard, row, col, ' ');
+            setCell(tempBoard, newRow, newCol, tempChar);
             row = newRow;
             col = newCol;
 
@@ -1432,13 +3327,12 @@ void selectDestinationWithWASD(char **board, int size, int srcRow, int srcCol, i
         }
     }
     clearScreen();
-    freeBoard(tempBoard, size);
+    freeBoard(tempBoard);
 }
 
-int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack1, MoveStack *redoStack1, MoveStack *undoStack2, MoveStack *redoStack2, int gameMode, int *gameLoaded, int difficulty, int writeToFileMode, int *totalEvaluations1, int *totalEvaluations2, int controlMode, int selectedRow, int selectedCol, int highlight)
+int makeMoveWASD(Board *board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack1, MoveStack *redoStack1, MoveStack *undoStack2, MoveStack *redoStack2, int gameMode, int *gameLoaded, int difficulty, int writeToFileMode, int *totalEvaluations1, int *totalEvaluations2, int controlMode, int selectedRow, int selectedCol, int highlight)
 {
     int srcRow, srcCol, destRow, destCol;
-    char piece;
     Player *currentPlayerPtr = (*currentPlayer == 1) ? player1 : player2;
     Player *opponentPlayer = (*currentPlayer == 1) ? player2 : player1;
     MoveStack *undoStack = (*currentPlayer == 1) ? undoStack1 : undoStack2;
@@ -1457,7 +3351,6 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
             {
                 srcRow = destRow;
                 srcCol = destCol;
-                piece = board[srcRow - 1][srcCol - 1];
             }
 
             selectDestinationWithWASD(board, size, srcRow, srcCol, &destRow, &destCol, player1, player2, gameMode, currentPlayer, &extraMove, controlMode);
@@ -1467,8 +3360,6 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
                 *currentPlayer = (*currentPlayer == 1) ? 2 : 1;
             }
 
-            piece = board[srcRow - 1][srcCol - 1];
-
             int deltaRow = abs(destRow - srcRow);
             int deltaCol = abs(destCol - srcCol);
 
@@ -1477,22 +3368,15 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
                 int midRow = (srcRow + destRow) / 2;
                 int midCol = (srcCol + destCol) / 2;
 
-                if (board[midRow - 1][midCol - 1] != ' ')
+                if (getCell(board, midRow - 1, midCol - 1) != ' ')
                 {
-                    board[destRow - 1][destCol - 1] = piece;
-                    board[srcRow - 1][srcCol - 1] = ' ';
-                    char capturedPiece = board[midRow - 1][midCol - 1];
-                    board[midRow - 1][midCol - 1] = ' ';
-
                     if (*gameLoaded)
                     {
                         currentPlayerPtr = (*currentPlayer == 1) ? player2 : player1;
                     }
 
-                    currentPlayerPtr->pieces[capturedPiece - 'A']++;
-                    calculateScore(currentPlayerPtr);
-
-                    Move move = {srcRow - 1, srcCol - 1, destRow - 1, destCol - 1, capturedPiece};
+                    Move move = {srcRow - 1, srcCol - 1, destRow - 1, destCol - 1, {' ', 0, 0}};
+                    playMove(board, currentPlayerPtr, &move);
                     pushMove(undoStack, move);
 
                     redoStack->top = -1;
@@ -1513,7 +3397,7 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
                     player2->undoUsed = 0;
                     player2->redoUsed = 0;
 
-                    int gameOverStatus = checkGameOver(board, size, player1, player2);
+                    int gameOverStatus = checkGameOver(board, size);
                     if (gameOverStatus == 1 || gameOverStatus == 2)
                     {
                         return gameOverStatus;
@@ -1532,8 +3416,8 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
     }
     else
     {
-        makeComputerMove(board, size, currentPlayer, player1, player2, undoStack, redoStack, difficulty, gameMode, writeToFileMode, totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
-        int gameOverStatus = checkGameOver(board, size, player1, player2);
+        makeComputerMove(&engineContext, board, size, currentPlayer, player1, player2, undoStack, redoStack, difficulty, gameMode, writeToFileMode, totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
+        int gameOverStatus = checkGameOver(board, size);
         if (gameOverStatus == 1 || gameOverStatus == 2)
         {
             return gameOverStatus;
@@ -1544,7 +3428,7 @@ int makeMoveWASD(char **board, int size, int *currentPlayer, Player *player1, Pl
     return 1;
 }
 
-int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack1, MoveStack *redoStack1, MoveStack *undoStack2, MoveStack *redoStack2, int gameMode, int *gameLoaded, int difficulty, int writeToFileMode, int *totalEvaluations1, int *totalEvaluations2, int controlMode, int selectedRow, int selectedCol, int highlight)
+int makeMoveXY(Board *board, int size, int *currentPlayer, Player *player1, Player *player2, MoveStack *undoStack1, MoveStack *redoStack1, MoveStack *undoStack2, MoveStack *redoStack2, int gameMode, int *gameLoaded, int difficulty, int writeToFileMode, int *totalEvaluations1, int *totalEvaluations2, int controlMode, int selectedRow, int selectedCol, int highlight)
 {
     int srcRow, srcCol, destRow, destCol;
     char piece;
@@ -1598,6 +3482,15 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
                         sleep_ms(1000);
                         main();
                     }
+                    else if (strcmp(input, "h") == 0)
+                    {
+                        AnalysisLine lines[HINT_LINES];
+                        int evaluations = 0;
+                        int lineCount = analysePosition(&hintContext, board, size, currentPlayerPtr, opponentPlayer, HINT_DEPTH, SEARCH_PROFILE_MEDIUM, HINT_LINES, moveTimeLimit(1), lines, &evaluations);
+                        printf("\nOnerilen hamleler (puan, ardindan beklenen oyun akisi):\n");
+                        printAnalysis(lines, lineCount, size);
+                        printf("\nOyuncu %d hamlesi\nHangi tas hareket ettirilecek (satir / sutun): ", *currentPlayer);
+                    }
                     else if (sscanf(input, "%d %d", &srcRow, &srcCol) == 2 && srcRow >= 1 && srcCol >= 1 && srcRow <= size && srcCol <= size)
                     {
                         valid = true;
@@ -1612,7 +3505,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
                     }
                 }
 
-                piece = board[srcRow - 1][srcCol - 1];
+                piece = getCell(board, srcRow - 1, srcCol - 1);
 
                 if (piece == ' ')
                 {
@@ -1625,7 +3518,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
 
                 srcRow = destRow;
                 srcCol = destCol;
-                piece = board[srcRow - 1][srcCol - 1];
+                piece = getCell(board, srcRow - 1, srcCol - 1);
             }
 
             if (!extraMove)
@@ -1671,7 +3564,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
             {
                 if (currentPlayerPtr->undoUsed == 0)
                 {
-                    undoMove(board, undoStack, redoStack, currentPlayerPtr, opponentPlayer);
+                    undoMove(board, undoStack, redoStack, currentPlayerPtr);
                     currentPlayerPtr->undoUsed = 1;
                     clearScreen();
                     printBoard(board, size, player1, player2, gameMode, controlMode, selectedRow, selectedCol, highlight);
@@ -1694,7 +3587,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
                 {
                     if (currentPlayerPtr->redoUsed == 0)
                     {
-                        redoMove(board, undoStack, redoStack, currentPlayerPtr, opponentPlayer);
+                        redoMove(board, undoStack, redoStack, currentPlayerPtr);
                         currentPlayerPtr->redoUsed = 1;
                         clearScreen();
                         printBoard(board, size, player1, player2, gameMode, controlMode, selectedRow, selectedCol, highlight);
@@ -1712,7 +3605,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
             else if (strcmp(input, "g") == 0 && extraMove)
             {
 
-                int gameOverStatus = checkGameOver(board, size, player1, player2);
+                int gameOverStatus = checkGameOver(board, size);
                 if (gameOverStatus == 1 || gameOverStatus == 2)
                 {
                     return gameOverStatus;
@@ -1751,7 +3644,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
                     return 0;
                 }
 
-                if (board[destRow - 1][destCol - 1] != ' ')
+                if (getCell(board, destRow - 1, destCol - 1) != ' ')
                 {
                     printf("\nHedef hucre dolu! Lutfen kaynak koordinatlarini da bastan girip tekrar deneyin.\n");
                     return 0;
@@ -1765,21 +3658,15 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
                     int midRow = (srcRow + destRow) / 2;
                     int midCol = (srcCol + destCol) / 2;
 
-                    if (board[midRow - 1][midCol - 1] != ' ')
+                    if (getCell(board, midRow - 1, midCol - 1) != ' ')
                     {
-                        board[destRow - 1][destCol - 1] = piece;
-                        board[srcRow - 1][srcCol - 1] = ' ';
-                        char capturedPiece = board[midRow - 1][midCol - 1];
-                        board[midRow - 1][midCol - 1] = ' ';
-
                         if (*gameLoaded)
                         {
                             currentPlayerPtr = (*currentPlayer == 1) ? player1 : player2;
                         }
-                        currentPlayerPtr->pieces[capturedPiece - 'A']++;
-                        calculateScore(currentPlayerPtr);
 
-                        Move move = {srcRow - 1, srcCol - 1, destRow - 1, destCol - 1, capturedPiece};
+                        Move move = {srcRow - 1, srcCol - 1, destRow - 1, destCol - 1, {' ', 0, 0}};
+                        playMove(board, currentPlayerPtr, &move);
                         pushMove(undoStack, move);
 
                         redoStack->top = -1;
@@ -1819,7 +3706,7 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
             }
         }
 
-        int gameOverStatus = checkGameOver(board, size, player1, player2);
+        int gameOverStatus = checkGameOver(board, size);
         if (gameOverStatus == 1 || gameOverStatus == 2)
         {
             return gameOverStatus;
@@ -1827,8 +3714,8 @@ int makeMoveXY(char **board, int size, int *currentPlayer, Player *player1, Play
     }
     else
     {
-        makeComputerMove(board, size, currentPlayer, player1, player2, undoStack, redoStack, difficulty, gameMode, writeToFileMode, totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
-        int gameOverStatus = checkGameOver(board, size, player1, player2);
+        makeComputerMove(&engineContext, board, size, currentPlayer, player1, player2, undoStack, redoStack, difficulty, gameMode, writeToFileMode, totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
+        int gameOverStatus = checkGameOver(board, size);
         if (gameOverStatus == 1 || gameOverStatus == 2)
         {
             return gameOverStatus;
@@ -1893,6 +3780,8 @@ void tutorial(char *input)
         "",
         "Hamle yapmadan once veya yaptiktan sonra oyunu kaydetmek icin 's' kaydettiginiz herhangi bir oyunu yuklemek icin 'l' tusuna basabilirsiniz.",
         "",
+        "Koordinatlarla hamle yaparken tas secmeden once 'h' tusuna basarak bilgisayarin sizin icin buldugu en iyi hamleleri gorebilirsiniz.",
+        "",
         "Hamle yaptiktan sonra \"undo\" yapmak icin 'u', \"redo\" yapmak icin 'r' tusuna basabilirsiniz.",
         "",
         "",
@@ -2070,6 +3959,7 @@ char mainMenuControlsText[] =
     "  Oyunu kaydetme: 's'\n"
     "  Yon tuslari modunda kaydetme: 'k'\n"
     "  Kayitli oyunu yukleme: 'l'\n"
+    "  Koordinat modunda hamle onerisi: 'h'\n"
     "  Siradaki oyuncuya gecme: 'g'\n"
     "  Koordinat ile hamle yapma: 'x y'\n"
     "  Yon tuslari ile ilerleme: 'w,a,s,d'\n"
@@ -2083,6 +3973,7 @@ int main()
 #ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
 #endif
+    loadEngineConfig();
     int size;
     int currentPlayer = 1;
     char command;
@@ -2175,8 +4066,19 @@ int main()
         if (gameMode == 3)
         {
 
-            printf("\n100 adet rastgele boyutta oyunun ciktisini \"aitest\" dosyasina yazdirmak icin 'a' tusuna basin.\n\nDIKKAT! Yazma islemi asiri uzun surebilir!\n\nBir adet oyunu terminalde simule etmek ise herhangi bir tusa basin:\n");
-            if (fgets(input, sizeof(input), stdin) != NULL && input[0] == 'a')
+            printf("\n100 adet rastgele boyutta oyunun ciktisini \"aitest\" dosyasina yazdirmak icin 'a' tusuna basin.\n\nDIKKAT! Yazma islemi asiri uzun surebilir!\n\nBilgisayarin aramasini thread sayisina gore olcmek icin 't' tusuna basin.\n\nBir adet oyunu terminalde simule etmek ise herhangi bir tusa basin:\n");
+            if (fgets(input, sizeof(input), stdin) != NULL && input[0] == 't')
+            {
+                benchmarkSearch();
+
+                printf("\nAna menuye donmek icin herhangi bir tusa basin: ");
+                if (fgets(input, sizeof(input), stdin) != NULL)
+                {
+                    clearScreen();
+                    main();
+                }
+            }
+            else if (input[0] == 'a')
             {
                 printf("\nSimulasyonlar dosyaya yaziliyor...\n");
                 writeToFileMode = 1;
@@ -2192,29 +4094,30 @@ int main()
                     size = (rand() % 10) + 6;
                     currentPlayer = 1;
 
-                    char **board = createBoard(size);
+                    Board *board = createBoard(size);
 
                     fillBoard(board, size);
+                    resetEngineContext();
 
-                    Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
-                    Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
+                    Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
+                    Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
 
                     initMoveStack(&undoStack1, size * size);
                     initMoveStack(&redoStack1, size * size);
                     initMoveStack(&undoStack2, size * size);
                     initMoveStack(&redoStack2, size * size);
 
-                    while (!checkGameOver(board, size, &player1, &player2))
+                    while (!checkGameOver(board, size))
                     {
                         if (currentPlayer == 1)
                         {
 
-                            makeComputerMove(board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, 3, gameMode, writeToFileMode, &totalEvaluations1, controlMode, selectedRow, selectedCol, highlight);
+                            makeComputerMove(&engineContext, board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, 3, gameMode, writeToFileMode, &totalEvaluations1, controlMode, selectedRow, selectedCol, highlight);
                         }
                         else
                         {
 
-                            makeComputerMove(board, size, &currentPlayer, &player2, &player1, &undoStack2, &redoStack2, 3, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
+                            makeComputerMove(&secondEngineContext, board, size, &currentPlayer, &player2, &player1, &undoStack2, &redoStack2, 3, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
                         }
                         currentPlayer = (currentPlayer == 1) ? 2 : 1;
                     }
@@ -2225,7 +4128,7 @@ int main()
                     {
                         for (int c = 0; c < size; c++)
                         {
-                            fprintf(file, "%c ", board[r][c]);
+                            fprintf(file, "%c ", getCell(board, r, c));
                         }
                         fprintf(file, "\n");
                     }
@@ -2247,7 +4150,7 @@ int main()
                     }
                     fprintf(file, "\n");
 
-                    freeBoard(board, size);
+                    freeBoard(board);
                     freeMoveStack(&undoStack1);
                     freeMoveStack(&redoStack1);
                     freeMoveStack(&undoStack2);
@@ -2296,29 +4199,30 @@ int main()
             clearScreen();
             printf("\nOyun tahtasi boyutunu girin (6-20): ");
 
-            char **board = createBoard(size);
+            Board *board = createBoard(size);
 
             fillBoard(board, size);
+            resetEngineContext();
 
-            Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
-            Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
+            Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
+            Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
 
             initMoveStack(&undoStack1, size * size);
             initMoveStack(&redoStack1, size * size);
             initMoveStack(&undoStack2, size * size);
             initMoveStack(&redoStack2, size * size);
 
-            while (!checkGameOver(board, size, &player1, &player2))
+            while (!checkGameOver(board, size))
             {
                 if (currentPlayer == 1)
                 {
 
-                    makeComputerMove(board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, 3, gameMode, writeToFileMode, &totalEvaluations1, controlMode, selectedRow, selectedCol, highlight);
+                    makeComputerMove(&engineContext, board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, 3, gameMode, writeToFileMode, &totalEvaluations1, controlMode, selectedRow, selectedCol, highlight);
                 }
                 else
                 {
 
-                    makeComputerMove(board, size, &currentPlayer, &player2, &player1, &undoStack2, &redoStack2, 3, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
+                    makeComputerMove(&secondEngineContext, board, size, &currentPlayer, &player2, &player1, &undoStack2, &redoStack2, 3, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
                 }
                 currentPlayer = (currentPlayer == 1) ? 2 : 1;
             }
@@ -2355,7 +4259,7 @@ int main()
                 if (input[0] == 'b' || input[0] == 'B')
                 {
 
-                    freeBoard(board, size);
+                    freeBoard(board);
                     freeMoveStack(&undoStack1);
                     freeMoveStack(&redoStack1);
                     freeMoveStack(&undoStack2);
@@ -2365,7 +4269,7 @@ int main()
                 else
                 {
 
-                    freeBoard(board, size);
+                    freeBoard(board);
                     freeMoveStack(&undoStack1);
                     freeMoveStack(&redoStack1);
                     freeMoveStack(&undoStack2);
@@ -2432,12 +4336,13 @@ int main()
             clearScreen();
             printf("\nTahta boyutu: %d\n\n", size);
 
-            char **board = createBoard(size);
+            Board *board = createBoard(size);
 
             fillBoard(board, size);
+            resetEngineContext();
 
-            Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
-            Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0};
+            Player player1 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
+            Player player2 = {0, {0, 0, 0, 0, 0}, 0, 0, 0, 0, 5};
 
             if (controlMode == 2)
             {
@@ -2486,7 +4391,7 @@ int main()
                     else
                     {
 
-                        makeComputerMove(board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, difficulty, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
+                        makeComputerMove(&engineContext, board, size, &currentPlayer, &player1, &player2, &undoStack1, &redoStack1, difficulty, gameMode, writeToFileMode, &totalEvaluations2, controlMode, selectedRow, selectedCol, highlight);
                         moveMade = 1;
                     }
                 }
@@ -2494,7 +4399,7 @@ int main()
                 if (moveMade)
                 {
 
-                    if (checkGameOver(board, size, &player1, &player2))
+                    if (checkGameOver(board, size))
                     {
                         printf("\nOyun bitti!\n\n");
                         printBoard(board, size, &player1, &player2, gameMode, controlMode, selectedRow, selectedCol, highlight);
@@ -2536,7 +4441,7 @@ int main()
                             if (input[0] == 'b' || input[0] == 'B')
                             {
 
-                                freeBoard(board, size);
+                                freeBoard(board);
                                 freeMoveStack(&undoStack1);
                                 freeMoveStack(&redoStack1);
                                 freeMoveStack(&undoStack2);
@@ -2546,7 +4451,7 @@ int main()
                             else
                             {
 
-                                freeBoard(board, size);
+                                freeBoard(board);
                                 freeMoveStack(&undoStack1);
                                 freeMoveStack(&redoStack1);
                                 freeMoveStack(&undoStack2);